@@ -0,0 +1,389 @@
+/*
+	Headless throughput benchmarks.
+
+	Runs every bundled ROM for a fixed number of emulated cycles one
+	Interpreter::Step at a time and with each execution engine, and reports
+	emulated instructions per second and the speedup over Step, then the
+	time the load-time control-flow analysis takes per ROM, the cost of
+	per-byte versus block RAM access and the throughput of many interpreters
+	sharing one core.
+
+	Usage: Chip8_benchmarks [cyclesPerRom]
+*/
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Application/RomLoader.h"
+#include "Constants.h"
+#include "Interpreter/Analysis/ControlFlowGraph.h"
+#include "Interpreter/Hardware/RAM.h"
+#include "Interpreter/Hardware/RandomProvider.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+
+// System
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// The machine the application runs: Cxkk calls RandomProvider directly
+	using MachineInterpreter = BasicInterpreter<Chip8Geometry, RandomProvider>;
+
+	// Instructions between 60 Hz timer ticks at the default CPU frequency
+	constexpr size_t kCyclesPerTimerTick = static_cast<size_t>(CPU_FREQUENCY_HZ / SYSTEM_TIMER_HZ);
+
+	//--------------------------------------------------------------------------------
+	struct BenchmarkResult
+	{
+		size_t mCycles = 0;
+		double mSeconds = 0.0;
+		bool mHalted = false;
+		bool mWaitingOnKey = false;
+	};
+
+	//--------------------------------------------------------------------------------
+	BenchmarkResult RunRom(const std::vector<uint8_t>& rom, ExecutionEngine engine, size_t cycleTarget)
+	{
+		RandomProvider randomProvider;
+		MachineInterpreter interpreter(randomProvider);
+		interpreter.SetExecutionEngine(engine);
+
+		BenchmarkResult result;
+		if (!interpreter.LoadRom(rom))
+		{
+			result.mHalted = true;
+			return result;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		while (result.mCycles < cycleTarget)
+		{
+			const RunResult run = interpreter.RunCycles(kCyclesPerTimerTick);
+			result.mCycles += run.mCyclesExecuted;
+
+			if (run.mShouldHalt)
+			{
+				result.mHalted = true;
+				break;
+			}
+
+			// No input arrives headless, so a key wait would block for good
+			if (interpreter.IsWaitingOnKey())
+			{
+				result.mWaitingOnKey = true;
+				break;
+			}
+
+			interpreter.DecrementTimers();
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		result.mSeconds = std::chrono::duration<double>(end - start).count();
+
+		return result;
+	}
+
+	// The baseline: one Interpreter::Step call per instruction
+	//--------------------------------------------------------------------------------
+	BenchmarkResult StepRom(const std::vector<uint8_t>& rom, size_t cycleTarget)
+	{
+		RandomProvider randomProvider;
+		MachineInterpreter interpreter(randomProvider);
+
+		BenchmarkResult result;
+		if (!interpreter.LoadRom(rom))
+		{
+			result.mHalted = true;
+			return result;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		while (result.mCycles < cycleTarget)
+		{
+			const StepResult step = interpreter.Step();
+			if (step.mShouldHalt)
+			{
+				result.mHalted = true;
+				break;
+			}
+			if (step.mStatus != ExecutionStatus::Executed)
+			{
+				result.mWaitingOnKey = true;
+				break;
+			}
+
+			if (++result.mCycles % kCyclesPerTimerTick == 0)
+			{
+				interpreter.DecrementTimers();
+			}
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		result.mSeconds = std::chrono::duration<double>(end - start).count();
+
+		return result;
+	}
+
+	//--------------------------------------------------------------------------------
+	double GetMips(const BenchmarkResult& result)
+	{
+		return (result.mSeconds > 0.0) ? static_cast<double>(result.mCycles) / result.mSeconds / 1e6 : 0.0;
+	}
+
+	// Average microseconds per analysis of the ROM
+	//--------------------------------------------------------------------------------
+	double TimeAnalysis(const std::vector<uint8_t>& rom)
+	{
+		constexpr int kRepetitions = 1000;
+		size_t blockCount = 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < kRepetitions; ++i)
+		{
+			blockCount += ControlFlowGraph::Analyze(rom).GetBlocks().size();
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		// Keep the loop from being optimised away
+		if (blockCount == 0)
+		{
+			std::printf("(no code found)\n");
+		}
+
+		return std::chrono::duration<double, std::micro>(end - start).count() / kRepetitions;
+	}
+
+	// Average nanoseconds per call of access
+	//--------------------------------------------------------------------------------
+	template <typename Access>
+	double TimeMemoryAccess(Access access)
+	{
+		constexpr int kRepetitions = 200'000;
+		uint32_t checksum = 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < kRepetitions; ++i)
+		{
+			checksum += access(static_cast<uint16_t>(0x300 + (i & 0xFF)));
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		// Keep the loop from being optimised away
+		if (checksum == 1)
+		{
+			std::printf("(checksum)\n");
+		}
+
+		return std::chrono::duration<double, std::nano>(end - start).count() / kRepetitions;
+	}
+
+	// The RAM access patterns of Dxyn, Fx55 and snapshots, byte by byte as they
+	// were and as blocks. The RAM is the interpreter's, with its write listeners.
+	//--------------------------------------------------------------------------------
+	void BenchmarkMemoryAccess()
+	{
+		RandomProvider randomProvider;
+		MachineInterpreter interpreter(randomProvider);
+		RAM& ram = interpreter.GetBus().mRAM;
+
+		std::array<uint8_t, REGISTER_COUNT> registers{ };
+		std::array<uint8_t, RAM_SIZE> memory{ };
+
+		const double spriteBytes = TimeMemoryAccess([&](uint16_t address)
+		{
+			uint32_t sum = 0;
+			for (uint16_t row = 0; row < 15; ++row)
+			{
+				sum += ram.Read((address + row) & RAM_ADDRESS_MASK);
+			}
+			return sum;
+		});
+		const double spriteBlock = TimeMemoryAccess([&](uint16_t address)
+		{
+			uint32_t sum = 0;
+			for (uint8_t byte : ram.View(address, 15))
+			{
+				sum += byte;
+			}
+			return sum;
+		});
+
+		const double storeBytes = TimeMemoryAccess([&](uint16_t address)
+		{
+			for (size_t index = 0; index < registers.size(); ++index)
+			{
+				ram.Write((address + static_cast<uint16_t>(index)) & RAM_ADDRESS_MASK, registers[index]);
+			}
+			return 0u;
+		});
+		const double storeBlock = TimeMemoryAccess([&](uint16_t address)
+		{
+			ram.WriteWrapped(address, registers);
+			return 0u;
+		});
+
+		const double copyBytes = TimeMemoryAccess([&](uint16_t)
+		{
+			for (uint16_t address = 0; address < RAM_SIZE; ++address)
+			{
+				memory[address] = ram.Read(address);
+			}
+			return static_cast<uint32_t>(memory[0x200]);
+		});
+		const double copyBlock = TimeMemoryAccess([&](uint16_t)
+		{
+			ram.CopyTo(memory);
+			return static_cast<uint32_t>(memory[0x200]);
+		});
+
+		std::printf("\n%-24s %12s %12s %10s\n", "Memory access", "Bytes (ns)", "Block (ns)", "Speedup");
+		std::printf("%-24s %12.2f %12.2f %9.1fx\n", "Sprite rows (Dxyn)", spriteBytes, spriteBlock, spriteBytes / spriteBlock);
+		std::printf("%-24s %12.2f %12.2f %9.1fx\n", "Register store (Fx55)", storeBytes, storeBlock, storeBytes / storeBlock);
+		std::printf("%-24s %12.2f %12.2f %9.1fx\n", "RAM copy (snapshot)", copyBytes, copyBlock, copyBytes / copyBlock);
+	}
+
+	// Runs instanceCount interpreters round robin, one timer tick each per turn,
+	// as a server hosting many machines on one core would. Instances are given
+	// the bundled ROMs in turn; those that halt or wait on a key drop out.
+	//--------------------------------------------------------------------------------
+	BenchmarkResult RunInstances(const std::vector<std::vector<uint8_t>>& roms, ExecutionEngine engine, size_t instanceCount, size_t cycleTarget)
+	{
+		RandomProvider randomProvider;
+		std::vector<std::unique_ptr<MachineInterpreter>> interpreters;
+		interpreters.reserve(instanceCount);
+
+		for (size_t index = 0; index < instanceCount; ++index)
+		{
+			std::unique_ptr<MachineInterpreter> interpreter = std::make_unique<MachineInterpreter>(randomProvider);
+			interpreter->SetExecutionEngine(engine);
+			if (interpreter->LoadRom(roms[index % roms.size()]))
+			{
+				interpreters.push_back(std::move(interpreter));
+			}
+		}
+
+		// One pass over the instances, returning the cycles run
+		auto runRound = [&interpreters]()
+		{
+			size_t cycles = 0;
+			for (size_t index = 0; index < interpreters.size(); )
+			{
+				MachineInterpreter& interpreter = *interpreters[index];
+				const RunResult run = interpreter.RunCycles(kCyclesPerTimerTick);
+				cycles += run.mCyclesExecuted;
+				interpreter.DecrementTimers();
+
+				if (run.mShouldHalt || interpreter.IsWaitingOnKey())
+				{
+					interpreters[index] = std::move(interpreters.back());
+					interpreters.pop_back();
+					continue;
+				}
+				++index;
+			}
+			return cycles;
+		};
+
+		// Untimed warm-up, so block and JIT compilation of the ROMs' start-up code
+		// is not counted as layout cost
+		for (int round = 0; round < 8; ++round)
+		{
+			runRound();
+		}
+
+		BenchmarkResult result;
+		const auto start = std::chrono::steady_clock::now();
+
+		while (result.mCycles < cycleTarget && !interpreters.empty())
+		{
+			result.mCycles += runRound();
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		result.mSeconds = std::chrono::duration<double>(end - start).count();
+
+		return result;
+	}
+}
+
+//--------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+	const size_t cycleTarget = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+	const std::vector<std::pair<ExecutionEngine, const char*>> engines = {
+		{ ExecutionEngine::kSwitch, "switch" },
+		{ ExecutionEngine::kThreaded, "threaded" },
+		{ ExecutionEngine::kBlock, "block" },
+		{ ExecutionEngine::kJit, "jit" },
+		{ ExecutionEngine::kClosure, "closure" },
+	};
+
+	const RomLoader romLoader(ROMS_PATH);
+
+	std::printf("%-24s %-10s %12s %10s %10s %9s\n", "ROM", "Engine", "Cycles", "Seconds", "MIPS", "vs Step");
+
+	auto printResult = [](const std::string& romName, const char* engineName, const BenchmarkResult& result, double stepMips)
+	{
+		const double mips = GetMips(result);
+		std::printf("%-24s %-10s %12zu %10.4f %10.2f %8.1fx%s\n",
+			romName.c_str(), engineName, result.mCycles, result.mSeconds, mips, (stepMips > 0.0) ? mips / stepMips : 0.0,
+			result.mHalted ? "  (halted)" : (result.mWaitingOnKey ? "  (waiting on key)" : ""));
+	};
+
+	for (const std::string& romName : romLoader.GetRoms())
+	{
+		const std::vector<uint8_t> rom = romLoader.LoadRom(romName);
+
+		const BenchmarkResult stepResult = StepRom(rom, cycleTarget);
+		const double stepMips = GetMips(stepResult);
+		printResult(romName, "step", stepResult, stepMips);
+
+		for (const auto& [engine, engineName] : engines)
+		{
+			printResult(romName, engineName, RunRom(rom, engine, cycleTarget), stepMips);
+		}
+	}
+
+	std::printf("\n%-24s %10s %14s\n", "ROM", "Blocks", "Analysis (us)");
+
+	for (const std::string& romName : romLoader.GetRoms())
+	{
+		const std::vector<uint8_t> rom = romLoader.LoadRom(romName);
+		std::printf("%-24s %10zu %14.2f\n", romName.c_str(), ControlFlowGraph::Analyze(rom).GetBlocks().size(), TimeAnalysis(rom));
+	}
+
+	BenchmarkMemoryAccess();
+
+	std::vector<std::vector<uint8_t>> roms;
+	for (const std::string& romName : romLoader.GetRoms())
+	{
+		roms.push_back(romLoader.LoadRom(romName));
+	}
+
+	std::printf("\n%-24s %-10s %12s %10s %10s\n", "Instances", "Engine", "Cycles", "Seconds", "MIPS");
+	std::printf("(%zu bytes per interpreter)\n", sizeof(MachineInterpreter));
+
+	for (const size_t instanceCount : { 1u, 64u, 1024u, 4096u })
+	{
+		for (const auto& [engine, engineName] : engines)
+		{
+			const BenchmarkResult result = RunInstances(roms, engine, instanceCount, cycleTarget);
+			std::printf("%-24zu %-10s %12zu %10.4f %10.2f\n", instanceCount, engineName, result.mCycles, result.mSeconds, GetMips(result));
+		}
+	}
+
+	return 0;
+}
@@ -26,7 +26,7 @@ public:
 	{ 
 		sAppName = "";
 		
-		mController = std::make_unique<ApplicationController>(			
+		mController = std::make_unique<ApplicationController<OlcKeyInputProvider>>(			
 			std::make_unique<RomLoader>(ROMS_PATH),
 			std::make_unique<UIManager>(*this)
 		);
@@ -71,5 +71,5 @@ public:
 	}
 
 private:
-	std::unique_ptr<ApplicationController> mController;	
+	std::unique_ptr<ApplicationController<OlcKeyInputProvider>> mController;	
 };
\ No newline at end of file
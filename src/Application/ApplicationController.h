@@ -5,12 +5,13 @@
 // Interpreter
 #include "Application/Timer.h"
 #include "Application/TextSpinner.h"
-#include "Application/RandomProvider.h"
 #include "Interfaces/IUIManager.h"
 #include "Interfaces/IRomLoader.h"
 #include "Utils/TextUtils.h"
 #include "Types/Commands.h"
 #include "Interpreter/Interpreter.h"
+#include "Interpreter/Driver/MachineDriver.h"
+#include "Interpreter/Hardware/RandomProvider.h"
 #include "Strings.h"
 
 // System
@@ -18,9 +19,13 @@
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <variant>
 #include <vector>
 
+// Templated on the key input provider so the keypad polls it as its concrete
+// type, without a call through a function pointer or vtable.
 //--------------------------------------------------------------------------------
+template <KeyInputSource TInputProvider>
 class ApplicationController
 {
 #ifdef UNIT_TESTING
@@ -29,7 +34,7 @@ class ApplicationController
 
 public:
 	ApplicationController(std::unique_ptr<IRomLoader> romLoader, std::unique_ptr<IUIManager> uiManager)
-		: mInterpreter(mRandomProvider)
+		: mMachine(std::in_place_type<Chip8Machine>, mRandomProvider)
 		, mRomLoader(std::move(romLoader))
 		, mUIManager(std::move(uiManager))
 		, mState(ExecutionState::kNone)
@@ -38,11 +43,11 @@ public:
 		, mTextSpinner({ ".", "..", "..." }, 0.5f)
 	{ }
 
-	bool Initialize(std::unique_ptr<IKeyInputProvider> inputProvider)
+	bool Initialize(std::unique_ptr<TInputProvider> inputProvider)
 	{
 		// Bind runtime dependencies
-		mViewModel.mBus = &mInterpreter.GetBus();
-		mInterpreter.GetBus().mKeypad.SetInputProvider(std::move(inputProvider));
+		BindMachine();
+		mInputProvider = std::move(inputProvider);
 
 		// Set initial execution state and show ROM prompt
 		TransitionState(ExecutionState::kWaitingForRom);
@@ -53,7 +58,7 @@ public:
 
 		// Register ROM selection callback
 		mUIManager->SetOnRomSelectedCallback([&](size_t index) {
-			mInterpreter.Reset();
+			RestartMachine();
 
 			const auto& roms = mRomLoader->GetRoms();
 			assert(index < roms.size() && "ROM index out of bounds");
@@ -96,7 +101,7 @@ public:
 
 	Keypad& GetKeypad()
 	{
-		return mInterpreter.GetBus().mKeypad;
+		return std::visit([](auto& machine) -> Keypad& { return machine.mInterpreter.GetBus().mKeypad; }, mMachine);
 	}
 
 private:
@@ -155,7 +160,7 @@ private:
 
 	void OnResetCommand()
 	{
-		mInterpreter.Reset();
+		RestartMachine();
 		TransitionState(ExecutionState::kStepping);
 		DisplayNotification(Strings::Notifications::kWaitingForStepInput, false);
 	}
@@ -174,47 +179,65 @@ private:
 		std::string notification = std::format("{}{}", Strings::Notifications::kRunning, mTextSpinner.Update(elapsedTime));
 		DisplayNotification(notification, false);
 
-		for (size_t i = 0; i < mInstructionTimer.ComputeStepCount(elapsedTime); i++)
+		// Resume the machine for the frame's budget. It yields at each timer tick and
+		// at a key wait, which idles out the frame as input is only polled per frame.
+		size_t cycleBudget = mInstructionTimer.ComputeStepCount(elapsedTime);
+		while (cycleBudget > 0)
 		{
-			if (!ExecuteStep())
+			const Suspension suspension = std::visit([&](auto& machine) { return machine.mDriver.Resume(cycleBudget); }, mMachine);
+			if (suspension.mReason == SuspendReason::kHalted)
 			{
-				break;
+				Halt(suspension.mStatus);
+				return;
 			}
+
+			cycleBudget -= suspension.mCyclesElapsed;
 		}
 	}
 
 	void UpdateSystemTimer(float elapsedTime)
 	{
+		// While playing, the machine driver ticks the timers on emulated cycles
+		if (mState == ExecutionState::kPlaying)
+		{
+			return;
+		}
+
 		for (size_t i = 0; i < mSystemTimer.ComputeStepCount(elapsedTime); i++)
 		{
-			mInterpreter.DecrementTimers();
+			std::visit([](auto& machine) { machine.mInterpreter.DecrementTimers(); }, mMachine);
 		}
 	}
 
 	bool ExecuteStep()
 	{
-		const StepResult result = mInterpreter.Step();
+		const StepResult result = std::visit([](auto& machine) { return machine.mInterpreter.Step(); }, mMachine);
 		if (result.mShouldHalt)
 		{
-			TransitionState(ExecutionState::kHalted);
-			DisplayNotification("Execution Halted (" + Strings::ExecutionStatusToString(result.mStatus) + ")", true);
+			Halt(result.mStatus);
 			return false;
 		}
 
 		return true;
 	}
 
+	void Halt(ExecutionStatus status)
+	{
+		TransitionState(ExecutionState::kHalted);
+		DisplayNotification("Execution Halted (" + Strings::ExecutionStatusToString(status) + ")", true);
+	}
+
 	//-----------------
 	// UI & Interaction
 	//-----------------
 	void PollInput()
 	{
-		mInterpreter.GetBus().mKeypad.PollKeypad();
+		GetKeypad().PollKeypad(*mInputProvider);
 	}
 	
 	void CaptureNextInstruction()
 	{
-		mViewModel.mSnapshot = mInterpreter.PeekNextInstruction();
+		mViewModel.mSnapshot = std::visit([](const auto& machine) { return machine.mInterpreter.PeekNextInstruction(); }, mMachine);
 		PrintInstruction(mViewModel.mSnapshot);
 	}
 
@@ -245,7 +268,76 @@ private:
 	//---------------
 	bool TrySelectRomByName(std::string_view romName)
 	{
-		return mInterpreter.LoadRom(mRomLoader->LoadRom(romName));
+		const InstructionSet instructionSet = GetInstructionSetForRom(romName);
+		const QuirkProfile quirkProfile = (instructionSet == InstructionSet::kSuperChip) ? QuirkProfile::kSchip : QuirkProfile::kModern;
+
+		// The extended sets draw in high-res mode, which needs the 128x64 display,
+		// and XO-CHIP addresses 64 KB
+		switch (instructionSet)
+		{
+			case InstructionSet::kChip8:
+				SelectMachine<Chip8Machine>();
+				break;
+			case InstructionSet::kSuperChip:
+				SelectMachine<SuperChipMachine>();
+				break;
+			case InstructionSet::kXoChip:
+				SelectMachine<XoChipMachine>();
+				break;
+		}
+
+		return std::visit([&](auto& machine) { return machine.mInterpreter.LoadRom(mRomLoader->LoadRom(romName), quirkProfile, instructionSet); }, mMachine);
+	}
+
+	// By the conventional file extensions: .sc8 for SUPER-CHIP, .xo8 for XO-CHIP
+	static InstructionSet GetInstructionSetForRom(std::string_view romName)
+	{
+		if (romName.ends_with(".sc8"))
+		{
+			return InstructionSet::kSuperChip;
+		}
+		if (romName.ends_with(".xo8"))
+		{
+			return InstructionSet::kXoChip;
+		}
+		return InstructionSet::kChip8;
+	}
+
+	//------------------
+	// Machine Selection
+	//------------------
+	// Replaces the machine if it is built for another geometry. The key bindings
+	// carry over.
+	template <typename TMachine>
+	void SelectMachine()
+	{
+		if (std::holds_alternative<TMachine>(mMachine))
+		{
+			return;
+		}
+
+		const Keypad keypad = GetKeypad();
+		mMachine.template emplace<TMachine>(mRandomProvider);
+		GetKeypad() = keypad;
+		BindMachine();
+	}
+
+	void BindMachine()
+	{
+		std::visit([&](auto& machine) {
+			machine.mInterpreter.SetIdleLoopSkipping(true);
+			machine.mInterpreter.SetExecutionMode(ExecutionMode::kChecked);
+			mViewModel.mKeypad = &machine.mInterpreter.GetBus().mKeypad;
+			mViewModel.mDisplay = machine.mInterpreter.GetBus().mDisplay.GetView();
+		}, mMachine);
+	}
+
+	void RestartMachine()
+	{
+		std::visit([](auto& machine) {
+			machine.mInterpreter.Reset();
+			machine.mDriver.Restart();
+		}, mMachine);
 	}
 
 	//-----------------
@@ -287,13 +379,33 @@ private:
 		}
 	}
 
+	// An interpreter and its driver for one display geometry. Machines are built
+	// for RandomProvider, so Cxkk calls it directly rather than through
+	// IRandomProvider.
+	template <typename Geometry>
+	struct Machine
+	{
+		explicit Machine(RandomProvider& randomProvider)
+			: mInterpreter(randomProvider)
+			, mDriver(mInterpreter)
+		{ }
+
+		BasicInterpreter<Geometry, RandomProvider> mInterpreter;
+		BasicMachineDriver<BasicInterpreter<Geometry, RandomProvider>> mDriver;
+	};
+
+	using Chip8Machine = Machine<Chip8Geometry>;
+	using SuperChipMachine = Machine<SuperChipGeometry>;
+	using XoChipMachine = Machine<XoChipGeometry>;
+
 	// Core execution
-	Interpreter mInterpreter;
+	std::variant<Chip8Machine, SuperChipMachine, XoChipMachine> mMachine;
 	ExecutionState mState;
 
 	// Dependencies
 	std::unique_ptr<IRomLoader> mRomLoader;
 	std::unique_ptr<IUIManager> mUIManager;
+	std::unique_ptr<TInputProvider> mInputProvider;
 	RandomProvider mRandomProvider;
 
 	// UI binding
@@ -27,6 +27,11 @@ namespace Strings
 			case ExecutionStatus::MissingHandler: return "Opcode handler missing";
 			case ExecutionStatus::InvalidAddressUnaligned: return "Address is unaligned";
 			case ExecutionStatus::InvalidAddressOutOfBounds: return "Address out of bounds";
+			case ExecutionStatus::StackOverflow: return "Stack overflow";
+			case ExecutionStatus::StackUnderflow: return "Stack underflow";
+			case ExecutionStatus::InvalidKey: return "Key out of range";
+			case ExecutionStatus::InvalidDigit: return "Font digit out of range";
+			case ExecutionStatus::ProgramExited: return "Program exited";
 			default: return "Unknown execution status";
 		}
 	}
@@ -22,9 +22,12 @@ inline constexpr int32_t SCREEN_PIXEL_SCALE = 2;
 
 // Memory config
 inline constexpr uint16_t RAM_SIZE = 4096;
+inline constexpr uint16_t RAM_ADDRESS_MASK = RAM_SIZE - 1; // Addresses are 12 bits
 inline constexpr uint16_t PROGRAM_START_ADDRESS = 0x200;
 inline constexpr uint8_t STACK_SIZE = 16;
+inline constexpr uint8_t STACK_INDEX_MASK = STACK_SIZE - 1;
 inline constexpr uint8_t REGISTER_COUNT = 16;
+inline constexpr size_t kCacheLineSize = 64; // Unit of layout for per-instance hot state
 
 // Display config
 inline constexpr uint8_t DISPLAY_WIDTH = 64;
@@ -63,4 +66,27 @@ inline constexpr std::array<uint8_t, 80> CHAR_SET = {
     0xe0, 0x90, 0x90, 0x90, 0xe0, // D
     0xf0, 0x80, 0xf0, 0x80, 0xf0, // E
     0xf0, 0x80, 0xf0, 0x80, 0x80  // F
+};
+
+// Large font set (SUPER-CHIP digits 09, XO-CHIP letters AF), stored after CHAR_SET
+//--------------------------------------------------------------------------------
+inline constexpr uint16_t BIG_CHAR_SET_ADDRESS = 0x050;
+inline constexpr uint16_t kBigFontSpriteSize = 10;
+inline constexpr std::array<uint8_t, 160> BIG_CHAR_SET = {
+    0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xc3, 0xc3, 0xe7, 0x7e, 0x3c, // 0
+    0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, // 1
+    0x3e, 0x7f, 0xc3, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xff, 0xff, // 2
+    0x3c, 0x7e, 0xc3, 0x03, 0x0e, 0x0e, 0x03, 0xc3, 0x7e, 0x3c, // 3
+    0x06, 0x0e, 0x1e, 0x36, 0x66, 0xc6, 0xff, 0xff, 0x06, 0x06, // 4
+    0xff, 0xff, 0xc0, 0xc0, 0xfc, 0xfe, 0x03, 0xc3, 0x7e, 0x3c, // 5
+    0x3e, 0x7c, 0xc0, 0xc0, 0xfc, 0xfe, 0xc3, 0xc3, 0x7e, 0x3c, // 6
+    0xff, 0xff, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x60, 0x60, // 7
+    0x3c, 0x7e, 0xc3, 0xc3, 0x7e, 0x7e, 0xc3, 0xc3, 0x7e, 0x3c, // 8
+    0x3c, 0x7e, 0xc3, 0xc3, 0x7f, 0x3f, 0x03, 0x03, 0x3e, 0x7c, // 9
+    0x7e, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xc3, // A
+    0xfc, 0xfc, 0xc3, 0xc3, 0xfc, 0xfc, 0xc3, 0xc3, 0xfc, 0xfc, // B
+    0x3c, 0xff, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xff, 0x3c, // C
+    0xfc, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xfc, // D
+    0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, // E
+    0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0  // F
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 //--------------------------------------------------------------------------------
 // System
+#include <concepts>
 #include <cstdint>
 
 //--------------------------------------------------------------------------------
@@ -10,4 +11,10 @@ class IKeyInputProvider
 public:
     virtual ~IKeyInputProvider() = default;
     virtual bool IsKeyPressed(uint8_t physicalKey) const = 0;
-};
\ No newline at end of file
+};
+
+// A concrete IKeyInputProvider. Passing the concrete type (ideally final) lets
+// the keypad poll it without a virtual call per key.
+//--------------------------------------------------------------------------------
+template <typename T>
+concept KeyInputSource = std::derived_from<T, IKeyInputProvider>;
@@ -2,12 +2,14 @@
 
 // Includes
 //--------------------------------------------------------------------------------
-// Project
-#include "Interfaces/IRandomProvider.h"
+// System
+#include <cstddef>
+#include <cstdint>
 
 //--------------------------------------------------------------------------------
-class RandomProvider : public IRandomProvider
+class IMemoryWriteListener
 {
 public:
-	virtual uint8_t GetRandomByte() override;
-};
\ No newline at end of file
+    virtual ~IMemoryWriteListener() = default;
+    virtual void OnMemoryWritten(size_t address, size_t length) = 0;
+};
@@ -3,6 +3,7 @@
 // Includes
 //--------------------------------------------------------------------------------
 // System
+#include <concepts>
 #include <cstdint>
 
 //--------------------------------------------------------------------------------
@@ -11,4 +12,13 @@ class IRandomProvider
 public:
     virtual ~IRandomProvider() = default;
     virtual uint8_t GetRandomByte() = 0;
-};
\ No newline at end of file
+};
+
+// Anything usable as a random byte source, bound at compile time. IRandomProvider
+// satisfies it too, so mocks keep working through the virtual call.
+//--------------------------------------------------------------------------------
+template <typename T>
+concept RandomSource = requires(T& source)
+{
+    { source.GetRandomByte() } -> std::same_as<uint8_t>;
+};
@@ -0,0 +1,238 @@
+#include "Interpreter/Analysis/ControlFlowGraph.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Instruction/DecodeTable.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
+
+// System
+#include <algorithm>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// Decodes the instruction at address. Invalid if outside the ROM or not decodable.
+	//--------------------------------------------------------------------------------
+	Instruction DecodeAt(const DecodeTable::Table& decodeTable, std::span<const uint8_t> rom, size_t address)
+	{
+		if (address < PROGRAM_START_ADDRESS || address + 1 >= PROGRAM_START_ADDRESS + rom.size())
+		{
+			return { };
+		}
+
+		const size_t offset = address - PROGRAM_START_ADDRESS;
+		const uint16_t opcode = static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+		const OpcodeId opcodeId = decodeTable[opcode];
+		return (opcodeId == OpcodeId::UNASSIGNED) ? Instruction() : Instruction(opcodeId, opcode);
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+auto BasicControlFlowGraph<Geometry>::Analyze(std::span<const uint8_t> rom, InstructionSet instructionSet) -> BasicControlFlowGraph
+{
+	/*
+		The first pass walks every path from the program start, flagging each
+		instruction it reaches and the leaders: jump and call targets, return
+		sites, both outcomes of each skip and the instruction after anything else
+		that ends a block (see EndsBasicBlock). The second pass cuts the blocks
+		between leaders in address order, and the last collects unreached ROM
+		bytes into data regions. Everything is indexed by address, so the cost is
+		linear in the size of the ROM.
+	*/
+
+	BasicControlFlowGraph graph;
+	std::array<uint8_t, Geometry::kRamSize>& flags = graph.mFlags;
+	const DecodeTable::Table& decodeTable = DecodeTable::Get(instructionSet);
+	std::vector<uint16_t> worklist;
+
+	auto addLeader = [&](size_t address)
+	{
+		if (address < Geometry::kRamSize)
+		{
+			flags[address] |= AddressFlags::kBlockStart;
+			worklist.push_back(static_cast<uint16_t>(address));
+		}
+	};
+
+	addLeader(PROGRAM_START_ADDRESS);
+
+	while (!worklist.empty())
+	{
+		const size_t address = worklist.back();
+		worklist.pop_back();
+
+		if ((flags[address] & (AddressFlags::kInstruction | AddressFlags::kUndecodable)) != 0)
+		{
+			continue;
+		}
+
+		const Instruction instruction = DecodeAt(decodeTable, rom, address);
+		if (!instruction.IsValid())
+		{
+			// Left for the interpreter to report if it is ever executed
+			flags[address] |= AddressFlags::kUndecodable;
+			continue;
+		}
+
+		flags[address] |= AddressFlags::kInstruction;
+		flags[address + 1] |= AddressFlags::kOperand;
+
+		const OpcodeId opcodeId = instruction.GetOpcodeId();
+		const size_t next = address + INSTRUCTION_SIZE;
+
+		switch (GetControlFlow(opcodeId))
+		{
+			case ControlFlow::kJump:
+				addLeader(instruction.GetOperandNNN());
+				break;
+
+			case ControlFlow::kCall:
+				if ((flags[instruction.GetOperandNNN()] & AddressFlags::kSubroutine) == 0)
+				{
+					flags[instruction.GetOperandNNN()] |= AddressFlags::kSubroutine;
+					graph.mSubroutines.push_back(instruction.GetOperandNNN());
+				}
+				addLeader(instruction.GetOperandNNN());
+				addLeader(next);
+				break;
+
+			case ControlFlow::kSkip:
+				addLeader(next);
+				addLeader(next + GetInstructionLength(DecodeAt(decodeTable, rom, next).GetOpcodeId()));
+				break;
+
+			case ControlFlow::kLongLoad:
+				if (next + 1 < Geometry::kRamSize)
+				{
+					flags[next] |= AddressFlags::kOperand;
+					flags[next + 1] |= AddressFlags::kOperand;
+				}
+				addLeader(next + INSTRUCTION_SIZE);
+				break;
+
+			case ControlFlow::kIndirectJump:
+				flags[address] |= AddressFlags::kIndirectJump;
+				graph.mIndirectJumpSites.push_back(static_cast<uint16_t>(address));
+				break;
+
+			case ControlFlow::kReturn:
+			case ControlFlow::kExit:
+				break;
+
+			case ControlFlow::kWaitForKey:
+				addLeader(next);
+				break;
+
+			case ControlFlow::kSequential:
+				if (next < Geometry::kRamSize)
+				{
+					worklist.push_back(static_cast<uint16_t>(next));
+				}
+				break;
+		}
+	}
+
+	std::sort(graph.mSubroutines.begin(), graph.mSubroutines.end());
+	std::sort(graph.mIndirectJumpSites.begin(), graph.mIndirectJumpSites.end());
+
+	for (size_t leader = PROGRAM_START_ADDRESS; leader < Geometry::kRamSize; ++leader)
+	{
+		if ((flags[leader] & AddressFlags::kBlockStart) == 0 || (flags[leader] & AddressFlags::kInstruction) == 0)
+		{
+			continue;
+		}
+
+		BasicBlock block;
+		block.mStart = static_cast<uint16_t>(leader);
+
+		size_t address = leader;
+		Instruction last;
+		do
+		{
+			last = DecodeAt(decodeTable, rom, address);
+			address += INSTRUCTION_SIZE;
+		}
+		while (!EndsBasicBlock(last.GetOpcodeId()) && address < Geometry::kRamSize
+			&& (flags[address] & AddressFlags::kInstruction) != 0 && (flags[address] & AddressFlags::kBlockStart) == 0);
+
+		block.mEnd = static_cast<uint16_t>(address);
+
+		switch (GetControlFlow(last.GetOpcodeId()))
+		{
+			case ControlFlow::kJump:
+				block.mSuccessors = { last.GetOperandNNN() };
+				break;
+
+			case ControlFlow::kCall:
+				block.mSuccessors = { last.GetOperandNNN(), block.mEnd };
+				break;
+
+			case ControlFlow::kSkip:
+			{
+				const Instruction skipped = DecodeAt(decodeTable, rom, block.mEnd);
+				block.mSuccessors = { block.mEnd, static_cast<uint16_t>(block.mEnd + GetInstructionLength(skipped.GetOpcodeId())) };
+				break;
+			}
+
+			case ControlFlow::kReturn:
+			case ControlFlow::kIndirectJump:
+			case ControlFlow::kExit:
+				break;
+
+			case ControlFlow::kLongLoad:
+				block.mSuccessors = { static_cast<uint16_t>(block.mEnd + INSTRUCTION_SIZE) };
+				break;
+
+			case ControlFlow::kWaitForKey:
+			case ControlFlow::kSequential:
+				block.mSuccessors = { block.mEnd };
+				break;
+		}
+
+		graph.mBlocks.push_back(std::move(block));
+	}
+
+	const size_t romEnd = std::min<size_t>(PROGRAM_START_ADDRESS + rom.size(), Geometry::kRamSize);
+	for (size_t address = PROGRAM_START_ADDRESS; address < romEnd; ++address)
+	{
+		if ((flags[address] & (AddressFlags::kInstruction | AddressFlags::kOperand)) != 0)
+		{
+			continue;
+		}
+
+		flags[address] |= AddressFlags::kData;
+
+		if (!graph.mDataRegions.empty() && graph.mDataRegions.back().mEnd == address)
+		{
+			graph.mDataRegions.back().mEnd++;
+		}
+		else
+		{
+			graph.mDataRegions.push_back({ static_cast<uint16_t>(address), static_cast<uint16_t>(address + 1) });
+		}
+	}
+
+	return graph;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+const BasicBlock* BasicControlFlowGraph<Geometry>::FindBlock(size_t address) const
+{
+	const auto after = std::upper_bound(mBlocks.begin(), mBlocks.end(), address,
+		[](size_t value, const BasicBlock& block) { return value < block.mStart; });
+
+	if (after == mBlocks.begin())
+	{
+		return nullptr;
+	}
+
+	const BasicBlock& block = *(after - 1);
+	return (address < block.mEnd) ? &block : nullptr;
+}
+
+#define INSTANTIATE_CONTROL_FLOW_GRAPH(Geometry) template class BasicControlFlowGraph<Geometry>;
+MACHINE_GEOMETRY_LIST(INSTANTIATE_CONTROL_FLOW_GRAPH)
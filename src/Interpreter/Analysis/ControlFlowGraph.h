@@ -0,0 +1,89 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Interpreter/Instruction/Instruction.h"
+#include "Types/InstructionSet.h"
+
+// System
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Per-address facts from the analysis, combined as bit flags.
+//--------------------------------------------------------------------------------
+namespace AddressFlags
+{
+	inline constexpr uint8_t kInstruction = 0x01;     // A reachable instruction starts here
+	inline constexpr uint8_t kOperand = 0x02;         // Second byte of a reachable instruction, or F000's nnnn
+	inline constexpr uint8_t kBlockStart = 0x04;      // First instruction of a basic block
+	inline constexpr uint8_t kSubroutine = 0x08;      // Target of a call (2nnn)
+	inline constexpr uint8_t kIndirectJump = 0x10;    // Bnnn, whose target is only known at run time
+	inline constexpr uint8_t kUndecodable = 0x20;     // Reachable, but not a valid instruction
+	inline constexpr uint8_t kData = 0x40;            // ROM byte never reached as code
+}
+
+// A maximal run of reachable instructions entered only at its first and left
+// only after its last. Successors are the statically known targets; blocks
+// ending in a return or Bnnn have none. A block ending in F000 nnnn stops
+// before the operand word, which no block covers.
+//--------------------------------------------------------------------------------
+struct BasicBlock
+{
+	uint16_t mStart = 0;
+	uint16_t mEnd = 0; // One past the last instruction
+	std::vector<uint16_t> mSuccessors;
+
+	size_t GetInstructionCount() const { return (mEnd - mStart) / INSTRUCTION_SIZE; }
+};
+
+// A run of ROM bytes that no path from the program start executes.
+//--------------------------------------------------------------------------------
+struct DataRegion
+{
+	uint16_t mStart = 0;
+	uint16_t mEnd = 0; // One past the last byte
+};
+
+// Static control-flow analysis of a ROM image, built once at load time so that
+// predecoders, translators, the disassembly view and coverage tools can share it
+// instead of rediscovering code while running.
+//
+// The walk starts at PROGRAM_START_ADDRESS and follows fall-through, jumps, calls
+// and both outcomes of skips. Returns and exits end a path (return sites are
+// reached from the call), as do Bnnn jumps, which are recorded as indirect jump sites: code
+// reached only through them is reported as data. Self-modifying code is not
+// modelled; the table describes the ROM as loaded into Geometry::kRamSize bytes.
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+class BasicControlFlowGraph
+{
+public:
+	static BasicControlFlowGraph Analyze(std::span<const uint8_t> rom, InstructionSet instructionSet = InstructionSet::kChip8);
+
+	uint8_t GetFlags(size_t address) const { return (address < Geometry::kRamSize) ? mFlags[address] : 0; }
+	bool IsInstruction(size_t address) const { return (GetFlags(address) & AddressFlags::kInstruction) != 0; }
+
+	// Returns the block containing the address, or nullptr if it is not code.
+	const BasicBlock* FindBlock(size_t address) const;
+
+	// In address order.
+	const std::vector<BasicBlock>& GetBlocks() const { return mBlocks; }
+	const std::vector<uint16_t>& GetSubroutines() const { return mSubroutines; }
+	const std::vector<uint16_t>& GetIndirectJumpSites() const { return mIndirectJumpSites; }
+	const std::vector<DataRegion>& GetDataRegions() const { return mDataRegions; }
+
+private:
+	std::array<uint8_t, Geometry::kRamSize> mFlags{ };
+	std::vector<BasicBlock> mBlocks;
+	std::vector<uint16_t> mSubroutines;
+	std::vector<uint16_t> mIndirectJumpSites;
+	std::vector<DataRegion> mDataRegions;
+};
+
+using ControlFlowGraph = BasicControlFlowGraph<Chip8Geometry>;
@@ -0,0 +1,88 @@
+#include "Interpreter/Aot/AotRuntime.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Interpreter.h"
+
+//--------------------------------------------------------------------------------
+RunResult AotRuntime::Run(Interpreter& interpreter, const AotModule& module, size_t cycleBudget)
+{
+	/*
+		A block only runs if the budget covers all of it and its bytes in RAM still
+		match the image it was compiled from. Anything else goes through Step one
+		instruction at a time, including an instruction that fails or defers inside
+		a block: PC is rolled back onto it and Step runs it again to report the
+		status. Handlers that fail or defer do so before touching any state, so
+		the second run behaves exactly like the first.
+	*/
+
+	CPU& cpu = interpreter.mCPU;
+	// Modules are recompiled from base CHIP-8 decoding
+	if (module.mQuirkProfile != cpu.GetQuirkProfile() || module.mExecutionMode != cpu.GetExecutionMode()
+		|| interpreter.GetTimingMode() != TimingMode::kInstruction || cpu.GetInstructionSet() != InstructionSet::kChip8)
+	{
+		return interpreter.RunCycles(cycleBudget);
+	}
+
+	const RAM& ram = interpreter.mBus.mRAM;
+	RunResult result;
+	if (interpreter.IsWaitingOnKey())
+	{
+		result.mStatus = ExecutionStatus::WaitingOnKeyPress;
+		result.mStopReason = StopReason::kWaitingOnKeyPress;
+		return result;
+	}
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const uint16_t entry = cpu.GetProgramCounter();
+		const size_t remaining = cycleBudget - result.mCyclesExecuted;
+		const AotBlock* block = module.mFindBlock(entry);
+
+		if (block != nullptr && block->mLength <= remaining)
+		{
+			const size_t offset = entry - PROGRAM_START_ADDRESS;
+			const size_t size = block->mLength * INSTRUCTION_SIZE;
+
+			if (ram.Equals(entry, module.mRom.subspan(offset, size)))
+			{
+				const AotBlockResult run = block->mRun(cpu);
+				result.mCyclesExecuted += run.mRetired;
+				interpreter.mClock.Advance(run.mRetired);
+				if (run.mStatus == ExecutionStatus::Executed)
+				{
+					continue;
+				}
+
+				cpu.SetProgramCounter(static_cast<uint16_t>(entry + run.mRetired * INSTRUCTION_SIZE));
+			}
+		}
+
+		const StepResult step = interpreter.Step();
+		if (step.mStatus == ExecutionStatus::Executed || step.mStatus == ExecutionStatus::WaitingOnKeyPress)
+		{
+			result.mCyclesExecuted++;
+		}
+
+		if (step.mStatus != ExecutionStatus::Executed)
+		{
+			result.mStatus = step.mStatus;
+			result.mShouldHalt = step.mShouldHalt;
+			break;
+		}
+	}
+
+	interpreter.UpdateKeyWait(result);
+
+	if (result.mShouldHalt)
+	{
+		result.mStopReason = StopReason::kHalted;
+	}
+	else if (result.mStatus == ExecutionStatus::WaitingOnKeyPress)
+	{
+		result.mStopReason = StopReason::kWaitingOnKeyPress;
+	}
+
+	return result;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/Quirks.h"
+#include "Interpreter/Instruction/Instruction.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionMode.h"
+#include "Types/ExecutionStatus.h"
+#include "Types/QuirkProfile.h"
+#include "Types/RunResult.h"
+
+// System
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Outcome of running one recompiled block.
+//--------------------------------------------------------------------------------
+struct AotBlockResult
+{
+	ExecutionStatus mStatus = ExecutionStatus::Executed; // Status of the last instruction run
+	uint16_t mRetired = 0; // Instructions that completed
+};
+
+using AotBlockFunction = AotBlockResult (*)(CPU& cpu);
+
+// A basic block recompiled to a native function. Like a TranslatedBlock, only the
+// last instruction may change control flow or write RAM.
+//--------------------------------------------------------------------------------
+struct AotBlock
+{
+	uint16_t mAddress = 0;
+	uint16_t mLength = 0; // Instructions
+	AotBlockFunction mRun = nullptr;
+};
+
+// A ROM recompiled ahead of time by RomRecompiler. The generated translation unit
+// defines one of these for the quirk policy it was built for.
+//--------------------------------------------------------------------------------
+struct AotModule
+{
+	QuirkProfile mQuirkProfile = QuirkProfile::kModern;
+	ExecutionMode mExecutionMode = ExecutionMode::kUnchecked;
+	std::span<const uint8_t> mRom; // Image the blocks were compiled from
+	const AotBlock* (*mFindBlock)(uint16_t address) = nullptr; // nullptr if no block starts there
+};
+
+// Runs recompiled modules against an Interpreter and provides the hooks the
+// generated code calls into. Generated code calls the handlers of CPU, so
+// modules only run on an Interpreter, the CHIP-8 machine they are compiled for.
+//--------------------------------------------------------------------------------
+class AotRuntime
+{
+public:
+	// Runs up to cycleBudget instructions with the same observable behaviour as
+	// Interpreter::RunCycles. The interpreter steps in wherever no block applies:
+	// computed jumps and returns to code that was never discovered, blocks whose
+	// bytes in RAM no longer match the ROM image, and the tail of a budget that
+	// ends inside a block. If the module was built for another quirk policy than
+	// the interpreter's, the whole run is left to the interpreter.
+	static RunResult Run(Interpreter& interpreter, const AotModule& module, size_t cycleBudget);
+
+	// Runs one instruction with the policy's handler, called directly. PC is set
+	// past the instruction first, exactly as Interpreter::Step does.
+	template <QuirkPolicy Quirks, OpcodeId kOpcodeId>
+	static ExecutionStatus Execute(CPU& cpu, uint16_t address, uint16_t opcode)
+	{
+		static constexpr CPU::ExecuteFunction kHandlers[] = {
+			#define HANDLER_FUNCTION(pattern, mnemonic) &CPU::Execute_##pattern##_##mnemonic,
+			#define QUIRK_HANDLER_FUNCTION(pattern, mnemonic) &CPU::Execute_##pattern##_##mnemonic<Quirks>,
+			OPCODE_HANDLER_LIST(HANDLER_FUNCTION, QUIRK_HANDLER_FUNCTION)
+			#undef QUIRK_HANDLER_FUNCTION
+			#undef HANDLER_FUNCTION
+		};
+
+		constexpr CPU::ExecuteFunction kHandler = kHandlers[static_cast<size_t>(kOpcodeId)];
+
+		cpu.SetProgramCounter(static_cast<uint16_t>(address + INSTRUCTION_SIZE));
+		return (cpu.*kHandler)(Instruction(kOpcodeId, opcode));
+	}
+};
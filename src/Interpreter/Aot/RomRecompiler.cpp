@@ -0,0 +1,294 @@
+#include "Interpreter/Aot/RomRecompiler.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Analysis/ControlFlowGraph.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Instruction/OpcodeTable.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
+
+// System
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// OpcodeId enumerator names, which match the handler mnemonics
+	constexpr const char* kOpcodeIdNames[] = {
+		#define OPCODE_ID_NAME(pattern, mnemonic) #mnemonic,
+		OPCODE_HANDLER_LIST(OPCODE_ID_NAME, OPCODE_ID_NAME)
+		#undef OPCODE_ID_NAME
+	};
+
+	//--------------------------------------------------------------------------------
+	class RomImage
+	{
+	public:
+		explicit RomImage(std::span<const uint8_t> rom)
+			: mRom(rom)
+		{ }
+
+		bool Contains(size_t address) const
+		{
+			return address >= PROGRAM_START_ADDRESS && address + 1 < PROGRAM_START_ADDRESS + mRom.size();
+		}
+
+		// Decodes the instruction at address. Invalid if outside the ROM or not decodable.
+		Instruction Decode(size_t address) const
+		{
+			if (!Contains(address))
+			{
+				return { };
+			}
+
+			const size_t offset = address - PROGRAM_START_ADDRESS;
+			const uint16_t opcode = static_cast<uint16_t>((mRom[offset] << 8) | mRom[offset + 1]);
+			const OpcodeId opcodeId = OpcodeTable::Match(opcode);
+			return (opcodeId == OpcodeId::UNASSIGNED) ? Instruction() : Instruction(opcodeId, opcode);
+		}
+
+	private:
+		std::span<const uint8_t> mRom;
+	};
+
+	// A block ends after control flow or a memory write, as in BlockCache
+	constexpr bool EndsBlock(OpcodeId opcodeId)
+	{
+		return EndsBasicBlock(opcodeId) || WritesMemory(opcodeId);
+	}
+
+	//--------------------------------------------------------------------------------
+	std::string Hex(uint32_t value, int width)
+	{
+		std::ostringstream stream;
+		stream << "0x" << std::uppercase << std::hex << std::setw(width) << std::setfill('0') << value;
+		return stream.str();
+	}
+
+	// e.g. "LD V0, 0x01"
+	//--------------------------------------------------------------------------------
+	std::string Disassemble(const Instruction& instruction)
+	{
+		const OpcodeSpec& spec = OpcodeTable::Get(instruction.GetOpcodeId());
+		std::string text = spec.mMnemonic;
+
+		for (size_t i = 0; i < spec.GetOperands().size(); ++i)
+		{
+			text += (i == 0) ? " " : ", ";
+
+			switch (spec.GetOperands()[i].mKind)
+			{
+				case OperandType::X:   text += "V" + Hex(static_cast<uint32_t>(instruction.GetOperandX()), 1).substr(2); break;
+				case OperandType::Y:   text += "V" + Hex(static_cast<uint32_t>(instruction.GetOperandY()), 1).substr(2); break;
+				case OperandType::KK:  text += Hex(instruction.GetOperandKK(), 2); break;
+				case OperandType::N:   text += std::to_string(instruction.GetOperandN()); break;
+				case OperandType::NNN: text += Hex(instruction.GetOperandNNN(), 3); break;
+			}
+		}
+
+		return text;
+	}
+
+	//--------------------------------------------------------------------------------
+	const char* GetPolicyName(QuirkProfile quirkProfile, ExecutionMode executionMode)
+	{
+		const bool isChecked = (executionMode == ExecutionMode::kChecked);
+
+		switch (quirkProfile)
+		{
+			case QuirkProfile::kCosmac: return isChecked ? "CheckedCosmacQuirks" : "CosmacQuirks";
+			case QuirkProfile::kSchip:  return isChecked ? "CheckedSchipQuirks" : "SchipQuirks";
+			case QuirkProfile::kModern:
+			default:                    return isChecked ? "CheckedModernQuirks" : "ModernQuirks";
+		}
+	}
+
+	//--------------------------------------------------------------------------------
+	const char* GetProfileName(QuirkProfile quirkProfile)
+	{
+		switch (quirkProfile)
+		{
+			case QuirkProfile::kCosmac: return "kCosmac";
+			case QuirkProfile::kSchip:  return "kSchip";
+			case QuirkProfile::kModern:
+			default:                    return "kModern";
+		}
+	}
+
+	//--------------------------------------------------------------------------------
+	std::string GetBlockName(const RecompiledBlock& block)
+	{
+		return "Block_" + Hex(block.mAddress, 3).substr(2);
+	}
+}
+
+//--------------------------------------------------------------------------------
+std::vector<RecompiledBlock> RomRecompiler::FindBlocks(std::span<const uint8_t> rom)
+{
+	/*
+		Discovery is the load-time control-flow analysis. Its basic blocks are cut
+		further after memory writes, as in BlockCache, so a block never runs on
+		past code it may have just overwritten, and at kMaxBlockLength.
+	*/
+
+	const RomImage image(rom);
+	const ControlFlowGraph graph = ControlFlowGraph::Analyze(rom);
+	std::vector<RecompiledBlock> blocks;
+
+	for (const BasicBlock& basicBlock : graph.GetBlocks())
+	{
+		RecompiledBlock block;
+		block.mAddress = basicBlock.mStart;
+
+		for (size_t address = basicBlock.mStart; address < basicBlock.mEnd; address += INSTRUCTION_SIZE)
+		{
+			const Instruction instruction = image.Decode(address);
+			block.mInstructions.push_back(instruction);
+
+			const size_t next = address + INSTRUCTION_SIZE;
+			if (next < basicBlock.mEnd && (EndsBlock(instruction.GetOpcodeId()) || block.mInstructions.size() == kMaxBlockLength))
+			{
+				blocks.push_back(std::move(block));
+				block = RecompiledBlock();
+				block.mAddress = static_cast<uint16_t>(next);
+			}
+		}
+
+		blocks.push_back(std::move(block));
+	}
+
+	return blocks;
+}
+
+//--------------------------------------------------------------------------------
+std::string RomRecompiler::Generate(std::span<const uint8_t> rom, std::string_view functionName, std::string_view sourceName,
+	QuirkProfile quirkProfile, ExecutionMode executionMode)
+{
+	const std::vector<RecompiledBlock> blocks = FindBlocks(rom);
+	const bool isChecked = (executionMode == ExecutionMode::kChecked);
+
+	std::ostringstream out;
+
+	out << "/*\n"
+		<< "\tGenerated by Chip8_recompiler from " << sourceName << ". Do not edit.\n"
+		<< "\n"
+		<< "\tPolicy " << GetPolicyName(quirkProfile, executionMode) << ", " << blocks.size() << " blocks.\n"
+		<< "\tDeclare the module and run it with AotRuntime:\n"
+		<< "\n"
+		<< "\t\tconst AotModule& " << functionName << "();\n"
+		<< "\t\tAotRuntime::Run(interpreter, " << functionName << "(), cycleBudget);\n"
+		<< "*/\n"
+		<< "\n"
+		<< "// Includes\n"
+		<< "//--------------------------------------------------------------------------------\n"
+		<< "// Interpreter\n"
+		<< "#include \"Interpreter/Aot/AotRuntime.h\"\n"
+		<< "\n"
+		<< "// System\n"
+		<< "#include <cstdint>\n"
+		<< "\n"
+		<< "// Anonymous namespace - limits linkage to this translation unit\n"
+		<< "//--------------------------------------------------------------------------------\n"
+		<< "namespace\n"
+		<< "{\n"
+		<< "\tusing Quirks = " << GetPolicyName(quirkProfile, executionMode) << ";\n"
+		<< "\n"
+		<< "\tconstexpr uint8_t kRom[] = {";
+
+	for (size_t i = 0; i < rom.size(); ++i)
+	{
+		out << ((i % 16 == 0) ? "\n\t\t" : " ") << Hex(rom[i], 2) << ",";
+	}
+	out << "\n\t};\n";
+
+	for (const RecompiledBlock& block : blocks)
+	{
+		const uint16_t endAddress = static_cast<uint16_t>(block.mAddress + block.mInstructions.size() * INSTRUCTION_SIZE);
+
+		out << "\n"
+			<< "\t// " << Hex(block.mAddress, 3) << " - " << Hex(endAddress - 1u, 3) << "\n"
+			<< "\t//--------------------------------------------------------------------------------\n"
+			<< "\tAotBlockResult " << GetBlockName(block) << "(CPU& cpu)\n"
+			<< "\t{\n"
+			<< "\t\tExecutionStatus status;\n";
+
+		for (size_t i = 0; i < block.mInstructions.size(); ++i)
+		{
+			const Instruction& instruction = block.mInstructions[i];
+			const uint32_t address = static_cast<uint32_t>(block.mAddress + i * INSTRUCTION_SIZE);
+
+			out << "\n"
+				<< "\t\t// " << OpcodeTable::Get(instruction.GetOpcodeId()).mPatternStr << "  " << Disassemble(instruction) << "\n"
+				<< "\t\tstatus = AotRuntime::Execute<Quirks, OpcodeId::" << kOpcodeIdNames[static_cast<size_t>(instruction.GetOpcodeId())] << ">"
+				<< "(cpu, " << Hex(address, 3) << ", " << Hex(instruction.GetOpcode(), 4) << ");\n"
+				<< "\t\tif (status != ExecutionStatus::Executed) { return { status, " << i << " }; }\n";
+		}
+
+		out << "\n"
+			<< "\t\treturn { ExecutionStatus::Executed, " << block.mInstructions.size() << " };\n"
+			<< "\t}\n";
+	}
+
+	out << "\n"
+		<< "\t//--------------------------------------------------------------------------------\n"
+		<< "\tconstexpr AotBlock kBlocks[] = {\n";
+
+	for (const RecompiledBlock& block : blocks)
+	{
+		out << "\t\t{ " << Hex(block.mAddress, 3) << ", " << block.mInstructions.size() << ", &" << GetBlockName(block) << " },\n";
+	}
+
+	out << "\t};\n"
+		<< "\n"
+		<< "\t//--------------------------------------------------------------------------------\n"
+		<< "\tconst AotBlock* FindBlock(uint16_t address)\n"
+		<< "\t{\n"
+		<< "\t\tswitch (address)\n"
+		<< "\t\t{\n";
+
+	for (size_t i = 0; i < blocks.size(); ++i)
+	{
+		out << "\t\t\tcase " << Hex(blocks[i].mAddress, 3) << ": return &kBlocks[" << i << "];\n";
+	}
+
+	out << "\t\t\tdefault: return nullptr;\n"
+		<< "\t\t}\n"
+		<< "\t}\n"
+		<< "}\n"
+		<< "\n"
+		<< "//--------------------------------------------------------------------------------\n"
+		<< "const AotModule& " << functionName << "()\n"
+		<< "{\n"
+		<< "\tstatic const AotModule kModule = {\n"
+		<< "\t\tQuirkProfile::" << GetProfileName(quirkProfile) << ",\n"
+		<< "\t\tExecutionMode::" << (isChecked ? "kChecked" : "kUnchecked") << ",\n"
+		<< "\t\tkRom,\n"
+		<< "\t\t&FindBlock,\n"
+		<< "\t};\n"
+		<< "\n"
+		<< "\treturn kModule;\n"
+		<< "}\n";
+
+	return out.str();
+}
+
+//--------------------------------------------------------------------------------
+std::string RomRecompiler::MakeFunctionName(std::string_view romName)
+{
+	const size_t extension = romName.rfind('.');
+	const std::string_view stem = romName.substr(0, extension);
+
+	std::string name = "Rom_";
+	for (const char c : stem)
+	{
+		name += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+	}
+
+	return name;
+}
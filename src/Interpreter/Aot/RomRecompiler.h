@@ -0,0 +1,47 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Instruction/Instruction.h"
+#include "Types/ExecutionMode.h"
+#include "Types/QuirkProfile.h"
+
+// System
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A basic block found by static discovery, in ROM order.
+//--------------------------------------------------------------------------------
+struct RecompiledBlock
+{
+	uint16_t mAddress = 0;
+	std::vector<Instruction> mInstructions;
+};
+
+// Ahead-of-time recompiler from a ROM image to a C++ translation unit. Each
+// reachable basic block becomes a function that calls the CPU's handlers for the
+// chosen quirk policy directly, and the unit defines an AotModule for AotRuntime
+// to run. See tools/RomRecompiler.cpp for the command line front end.
+//--------------------------------------------------------------------------------
+class RomRecompiler
+{
+public:
+	static constexpr size_t kMaxBlockLength = 64;
+
+	// The basic blocks of the ROM's control-flow graph (see ControlFlowGraph), split
+	// after memory writes and at kMaxBlockLength. Code only reached through a
+	// computed jump (Bnnn) is left to the interpreter at run time.
+	static std::vector<RecompiledBlock> FindBlocks(std::span<const uint8_t> rom);
+
+	// Returns the translation unit, which defines const AotModule& functionName().
+	static std::string Generate(std::span<const uint8_t> rom, std::string_view functionName, std::string_view sourceName,
+		QuirkProfile quirkProfile, ExecutionMode executionMode);
+
+	// Turns a ROM file name into a C++ identifier, e.g. "3-corax+.ch8" -> "Rom_3_corax_".
+	static std::string MakeFunctionName(std::string_view romName);
+};
@@ -6,15 +6,22 @@
 #include "Interpreter/Hardware/DelayTimer.h"
 #include "Interpreter/Hardware/Display.h"
 #include "Interpreter/Hardware/Keypad.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
 #include "Interpreter/Hardware/RAM.h"
 #include "Interpreter/Hardware/SoundTimer.h"
 
+// The memory and devices of one machine configuration (see MachineGeometry).
 //--------------------------------------------------------------------------------
-struct Bus
+template <typename Geometry>
+struct BasicBus
 {
-    RAM mRAM;
-    Display mDisplay;
+    using GeometryType = Geometry;
+
+    // Small devices first, so their hot fields share the leading lines instead
+    // of sitting behind kilobytes of memory and framebuffer
     Keypad mKeypad;
     DelayTimer mDelayTimer;
-    SoundTimer mSoundTimer;    
+    SoundTimer mSoundTimer;
+    BasicRAM<Geometry> mRAM;
+    BasicDisplay<Geometry> mDisplay;
 };
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "Interpreter/Driver/MachineDriver.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Interpreter.h"
+
+// System
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+void BasicMachineDriver<TInterpreter>::Task::promise_type::unhandled_exception() noexcept
+{
+	// The loop itself never throws; an exception here means a broken invariant
+	std::terminate();
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+BasicMachineDriver<TInterpreter>::BasicMachineDriver(TInterpreter& interpreter, const StopConditions& stopConditions, uint32_t timerFrequencyHz)
+	: mInterpreter(interpreter)
+	, mStopConditions(stopConditions)
+	, mTimerFrequencyHz(timerFrequencyHz)
+	, mHandle(Run().mHandle)
+{
+	assert(timerFrequencyHz > 0 && timerFrequencyHz <= interpreter.GetClock().GetFrequencyHz() && "Timers must tick at most once per cycle");
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+BasicMachineDriver<TInterpreter>::~BasicMachineDriver()
+{
+	mHandle.destroy();
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+void BasicMachineDriver<TInterpreter>::Restart()
+{
+	mHandle.destroy();
+	mHandle = Run().mHandle;
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+Suspension BasicMachineDriver<TInterpreter>::Resume(size_t cycleBudget)
+{
+	if (mHandle.done())
+	{
+		return { SuspendReason::kHalted, 0, mSuspension.mStatus };
+	}
+
+	mBudget = cycleBudget;
+	mSuspension.mCyclesElapsed = 0;
+	mHandle.resume();
+	return mSuspension;
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+auto BasicMachineDriver<TInterpreter>::Run() -> Task
+{
+	/*
+		Each pass runs at most up to the next timer tick, so ticks land on exact
+		clock cycles. The ticks issued so far are counted here rather than read
+		back from the clock before each pass: a timing mode change while the
+		loop is suspended rescales the clock, and rounding there may put it a
+		fraction of a cycle before a tick that has already been issued. Events
+		from the run are reported before the tick that ends the same pass.
+	*/
+
+	const MachineClock& clock = mInterpreter.GetClock();
+	uint64_t ticks = clock.CountTicks(clock.GetCycles(), mTimerFrequencyHz);
+
+	for (;;)
+	{
+		if (mBudget == 0)
+		{
+			co_await Suspend(SuspendReason::kBudgetExhausted);
+			continue;
+		}
+
+		const size_t passBudget = std::min(mBudget, GetCyclesUntilTick(ticks));
+		size_t elapsed = passBudget;
+		StopReason stopReason = StopReason::kBudgetExhausted;
+
+		// A blocked key wait executes nothing; its cycles just pass
+		if (mInterpreter.IsWaitingOnKey())
+		{
+			mInterpreter.AdvanceClock(passBudget);
+		}
+		else
+		{
+			const RunResult result = mInterpreter.RunCycles(passBudget, mStopConditions);
+			elapsed = result.mCyclesExecuted;
+			stopReason = result.mStopReason;
+			mSuspension.mStatus = result.mStatus;
+		}
+
+		mBudget -= elapsed;
+		mSuspension.mCyclesElapsed += elapsed;
+		const uint64_t ticksDue = clock.CountTicks(clock.GetCycles(), mTimerFrequencyHz);
+		const bool isTick = ticksDue > ticks;
+		if (isTick)
+		{
+			ticks = ticksDue;
+		}
+
+		switch (stopReason)
+		{
+			case StopReason::kHalted:
+				// The halting pass still owes the tick it reached
+				if (isTick)
+				{
+					mInterpreter.DecrementTimers();
+				}
+				mSuspension.mReason = SuspendReason::kHalted;
+				co_return;
+
+			case StopReason::kWaitingOnKeyPress:
+				co_await Suspend(SuspendReason::kWaitingOnKeyPress);
+				break;
+
+			case StopReason::kDisplayChanged:
+				co_await Suspend(SuspendReason::kDisplayChanged);
+				break;
+
+			case StopReason::kBreakpoint:
+				co_await Suspend(SuspendReason::kBreakpoint);
+				break;
+
+			case StopReason::kCycleReached:
+				co_await Suspend(SuspendReason::kCycleReached);
+				break;
+
+			case StopReason::kBudgetExhausted:
+			default:
+				break;
+		}
+
+		if (isTick)
+		{
+			mInterpreter.DecrementTimers();
+			co_await Suspend(SuspendReason::kTimerTick);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+size_t BasicMachineDriver<TInterpreter>::GetCyclesUntilTick(uint64_t ticks) const
+{
+	// Passes never cross a tick, so at most one falls due per pass (time that
+	// passed outside the driver may have brought the clock past several)
+	const MachineClock& clock = mInterpreter.GetClock();
+	const uint64_t now = clock.GetCycles();
+	const uint64_t nextTick = clock.GetTickCycle(std::max(ticks, clock.CountTicks(now, mTimerFrequencyHz)) + 1, mTimerFrequencyHz);
+	return static_cast<size_t>(nextTick - now);
+}
+
+// Explicit instantiations - one driver per machine
+//--------------------------------------------------------------------------------
+#define INSTANTIATE_DRIVER(Geometry, TRandom) template class BasicMachineDriver<BasicInterpreter<Geometry, TRandom>>;
+MACHINE_LIST(INSTANTIATE_DRIVER)
+#undef INSTANTIATE_DRIVER
@@ -0,0 +1,91 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/StopConditions.h"
+#include "Types/Suspension.h"
+
+// System
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+// Drives an interpreter as a coroutine. The emulation loop runs instructions and
+// suspends at its natural stopping points: every 60 Hz timer tick (the driver
+// owns the timers, ticking them on the interpreter's MachineClock), the start of
+// an Fx0A key wait, any stop conditions that are set, and a halt. Callers resume
+// it with a cycle budget and get back where it stopped and how many cycles
+// passed, so a frame loop, a headless runner or a scheduler over many machines
+// is just a loop over Resume.
+//
+// While Fx0A is blocked the machine idles: the budget elapses without executing
+// anything, so timers keep ticking until a key release wakes it.
+//
+// TInterpreter is the BasicInterpreter of one machine (see MACHINE_LIST).
+//--------------------------------------------------------------------------------
+template <typename TInterpreter>
+class BasicMachineDriver
+{
+public:
+	static constexpr uint32_t kDefaultTimerFrequencyHz = static_cast<uint32_t>(SYSTEM_TIMER_HZ);
+
+	// The stop conditions' breakpoints must outlive the driver.
+	explicit BasicMachineDriver(TInterpreter& interpreter, const StopConditions& stopConditions = { },
+		uint32_t timerFrequencyHz = kDefaultTimerFrequencyHz);
+	~BasicMachineDriver();
+
+	BasicMachineDriver(const BasicMachineDriver&) = delete;
+	BasicMachineDriver& operator=(const BasicMachineDriver&) = delete;
+
+	// Runs until the next suspension point or until cycleBudget cycles have
+	// passed. Once halted, returns kHalted at once until restarted.
+	Suspension Resume(size_t cycleBudget);
+
+	// Starts the emulation loop over, e.g. after the interpreter is reset or a
+	// ROM is loaded.
+	void Restart();
+
+	bool IsHalted() const { return mHandle.done(); }
+
+private:
+	struct Task
+	{
+		struct promise_type
+		{
+			Task get_return_object() { return { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+			std::suspend_always initial_suspend() noexcept { return { }; }
+			std::suspend_always final_suspend() noexcept { return { }; }
+			void return_void() noexcept { }
+			void unhandled_exception() noexcept;
+		};
+
+		std::coroutine_handle<promise_type> mHandle;
+	};
+
+	// Awaited at each suspension point; records why the loop stopped.
+	struct SuspendPoint
+	{
+		Suspension& mSuspension;
+		SuspendReason mReason;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<>) const noexcept { mSuspension.mReason = mReason; }
+		void await_resume() const noexcept { }
+	};
+
+	Task Run();
+	SuspendPoint Suspend(SuspendReason reason) { return { mSuspension, reason }; }
+	size_t GetCyclesUntilTick(uint64_t ticks) const;
+
+	TInterpreter& mInterpreter;
+	StopConditions mStopConditions;
+	uint32_t mTimerFrequencyHz;
+	size_t mBudget = 0;
+	Suspension mSuspension;
+	std::coroutine_handle<typename Task::promise_type> mHandle;
+};
+
+using MachineDriver = BasicMachineDriver<Interpreter>;
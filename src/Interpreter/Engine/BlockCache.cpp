@@ -0,0 +1,186 @@
+#include "Interpreter/Engine/BlockCache.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Engine/Superinstructions.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/RAM.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
+
+// System
+#include <algorithm>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// Plain function wrapper so a micro-op is one direct pointer, not a member pointer
+	template <typename TCPU, ExecutionStatus (TCPU::*Handler)(const Instruction&)>
+	MicroOpResult InvokeHandler(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+	{
+		const ExecutionStatus status = (cpu.*Handler)(op.mInstruction);
+		return { status, static_cast<uint8_t>(status == ExecutionStatus::Executed ? 1 : 0), 1 };
+	}
+
+	// A skip that can be fused with the jump it guards keeps the block open for it
+	constexpr bool IsFusableSkip(OpcodeId opcodeId)
+	{
+		return opcodeId == OpcodeId::SE_VX_KK || opcodeId == OpcodeId::SNE_VX_KK;
+	}
+
+	// A block ends after control flow or a memory write, so a write that patches
+	// the running block never has later ops of that block executed after it
+	constexpr bool EndsBlock(OpcodeId opcodeId)
+	{
+		return EndsBasicBlock(opcodeId) || WritesMemory(opcodeId);
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+BasicBlockCache<TCPU>::BasicBlockCache()
+	: mBlocks(kEntryCount)
+{ }
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+template <QuirkPolicy Quirks>
+auto BasicBlockCache<TCPU>::Translate(uint16_t address, const TCPU& cpu, const BasicRAM<Geometry>& ram) -> TranslatedBlock*
+{
+	/*
+		Only the entry address needs the full alignment and bounds check. Later
+		instructions follow it sequentially and only need the upper bound.
+	*/
+
+	if (address % INSTRUCTION_SIZE != 0 || address < PROGRAM_START_ADDRESS || address + 1u >= Geometry::kRamSize)
+	{
+		return nullptr;
+	}
+
+	TranslatedBlock& block = mBlocks[(address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE];
+	block.mOps.clear();
+	block.mNativeCode = nullptr;
+	block.mEntryCount = 0;
+
+	size_t pc = address;
+	while (pc + 1 < Geometry::kRamSize && block.mOps.size() < kMaxBlockLength)
+	{
+		const uint16_t opcode = static_cast<uint16_t>((ram.Read(static_cast<uint16_t>(pc)) << 8) | ram.Read(static_cast<uint16_t>(pc + 1)));
+		const Instruction instruction = cpu.Decode(opcode);
+		if (!instruction.IsValid())
+		{
+			// Left for the next dispatch to report as a decode error
+			break;
+		}
+
+		const OpcodeId opcodeId = instruction.GetOpcodeId();
+		const bool guardsJump = block.mOps.size() >= 1 && IsFusableSkip(block.mOps.back().mInstruction.GetOpcodeId());
+		if (guardsJump && opcodeId != OpcodeId::JP_ADDR)
+		{
+			// Only the guarded jump may follow a skip
+			break;
+		}
+
+		block.mOps.push_back({ GetHandler<Quirks>(opcodeId), instruction });
+		pc += INSTRUCTION_SIZE;
+
+		if (EndsBlock(opcodeId) && !IsFusableSkip(opcodeId))
+		{
+			break;
+		}
+	}
+
+	if (!block.IsValid())
+	{
+		return nullptr;
+	}
+
+	Superinstructions::Fuse<Quirks>(block.mOps);
+
+	block.mEndAddress = static_cast<uint32_t>(pc);
+	++mTranslationCount;
+	return &block;
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+template <QuirkPolicy Quirks>
+auto BasicBlockCache<TCPU>::GetHandler(OpcodeId opcodeId) -> typename MicroOp::Function
+{
+	static constexpr typename MicroOp::Function kHandlers[] = {
+		#define HANDLER_FUNCTION(pattern, mnemonic) &InvokeHandler<TCPU, &TCPU::Execute_##pattern##_##mnemonic>,
+		#define QUIRK_HANDLER_FUNCTION(pattern, mnemonic) &InvokeHandler<TCPU, &TCPU::template Execute_##pattern##_##mnemonic<Quirks>>,
+		OPCODE_HANDLER_LIST(HANDLER_FUNCTION, QUIRK_HANDLER_FUNCTION)
+		#undef QUIRK_HANDLER_FUNCTION
+		#undef HANDLER_FUNCTION
+	};
+
+	return kHandlers[static_cast<size_t>(opcodeId)];
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void BasicBlockCache<TCPU>::Clear()
+{
+	for (TranslatedBlock& block : mBlocks)
+	{
+		block.mOps.clear();
+		block.mNativeCode = nullptr;
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void BasicBlockCache<TCPU>::ClearNativeCode()
+{
+	for (TranslatedBlock& block : mBlocks)
+	{
+		block.mNativeCode = nullptr;
+		block.mEntryCount = 0;
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void BasicBlockCache<TCPU>::OnMemoryWritten(size_t address, size_t length)
+{
+	/*
+		A block covers at most kMaxBlockLength instructions, so only blocks entered
+		within that distance before the write can overlap it.
+	*/
+
+	const size_t end = address + length;
+	if (length == 0 || end <= PROGRAM_START_ADDRESS)
+	{
+		return;
+	}
+
+	const size_t kMaxBlockBytes = kMaxBlockLength * INSTRUCTION_SIZE;
+	const size_t windowStart = std::max<size_t>(address, PROGRAM_START_ADDRESS + kMaxBlockBytes) - kMaxBlockBytes;
+	const size_t first = (windowStart - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+	const size_t last = std::min((end - 1 - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE, kEntryCount - 1);
+
+	for (size_t index = first; index <= last; ++index)
+	{
+		TranslatedBlock& block = mBlocks[index];
+		if (block.IsValid() && block.mEndAddress > address)
+		{
+			block.mOps.clear();
+			block.mNativeCode = nullptr;
+		}
+	}
+}
+
+// Explicit instantiations - one cache per machine and, on each, one translator
+// per policy
+//--------------------------------------------------------------------------------
+#define INSTANTIATE_TRANSLATE(Quirks, Geometry, TRandom) \
+	template BasicTranslatedBlock<BasicCPU<Geometry, TRandom>>* BasicBlockCache<BasicCPU<Geometry, TRandom>>::Translate<Quirks>(uint16_t, const BasicCPU<Geometry, TRandom>&, const BasicRAM<Geometry>&); \
+	template BasicMicroOp<BasicCPU<Geometry, TRandom>>::Function BasicBlockCache<BasicCPU<Geometry, TRandom>>::GetHandler<Quirks>(OpcodeId);
+#define INSTANTIATE_BLOCK_CACHE(Geometry, TRandom) \
+	template class BasicBlockCache<BasicCPU<Geometry, TRandom>>; \
+	QUIRK_POLICY_LIST(INSTANTIATE_TRANSLATE, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_BLOCK_CACHE)
+#undef INSTANTIATE_BLOCK_CACHE
+#undef INSTANTIATE_TRANSLATE
\ No newline at end of file
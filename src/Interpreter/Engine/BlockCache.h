@@ -0,0 +1,136 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interfaces/IMemoryWriteListener.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Interpreter/Hardware/Quirks.h"
+#include "Interpreter/Instruction/Instruction.h"
+#include "Types/ExecutionStatus.h"
+
+// System
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Compiled form of a block (see JitCompiler for the budget and return value).
+template <typename TCPU>
+using BasicNativeBlockFunction = uint64_t (*)(TCPU* cpu, typename TCPU::StateType* state, uint64_t budget);
+
+// Outcome of running one micro-op. A fused op covers several ops of the block but
+// may retire fewer instructions, e.g. when a skip jumps over the 1nnn after it.
+//--------------------------------------------------------------------------------
+struct MicroOpResult
+{
+	ExecutionStatus mStatus = ExecutionStatus::Executed; // Status of the last instruction run
+	uint8_t mRetired = 0; // Instructions that completed
+	uint8_t mLength = 1;  // Ops of the block this op covers
+};
+
+// A decoded instruction bound to its handler, ready to execute without dispatch.
+// Fused handlers read the ops that follow them in the block.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+struct BasicMicroOp
+{
+	using Function = MicroOpResult (*)(TCPU& cpu, const BasicMicroOp& op);
+
+	Function mExecute = nullptr;
+	Instruction mInstruction;
+};
+
+// Straight-line run of instructions. Only the last op may change control flow
+// or write memory, so PC never needs validating inside the block. The one
+// exception is a 3xkk/4xkk skip, which may be followed by the 1nnn it guards
+// so the pair can be fused.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+struct BasicTranslatedBlock
+{
+	std::vector<BasicMicroOp<TCPU>> mOps;
+	uint32_t mEndAddress = 0; // One past the last instruction byte, so up to kRamSize
+
+	// Set by the JIT once the block has been entered often enough
+	BasicNativeBlockFunction<TCPU> mNativeCode = nullptr;
+	uint32_t mEntryCount = 0;
+
+	bool IsValid() const { return !mOps.empty(); }
+};
+
+// Translated basic blocks keyed by entry PC. Blocks overlapping a RAM write are
+// discarded, so self-modifying code is retranslated on its next entry. Blocks
+// bind the handlers of one CPU type, TCPU, and the cache covers its RAM.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+class BasicBlockCache : public IMemoryWriteListener
+{
+public:
+	using Geometry = typename TCPU::GeometryType;
+	using MicroOp = BasicMicroOp<TCPU>;
+	using TranslatedBlock = BasicTranslatedBlock<TCPU>;
+
+	static constexpr size_t kEntryCount = (Geometry::kRamSize - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+	static constexpr size_t kMaxBlockLength = 64;
+
+	BasicBlockCache();
+
+	// Returns the cached block for the entry address, or nullptr.
+	TranslatedBlock* Find(uint16_t address)
+	{
+		return const_cast<TranslatedBlock*>(static_cast<const BasicBlockCache&>(*this).Find(address));
+	}
+
+	const TranslatedBlock* Find(uint16_t address) const
+	{
+		const uint16_t offset = static_cast<uint16_t>(address - PROGRAM_START_ADDRESS);
+		const size_t index = offset / INSTRUCTION_SIZE;
+
+		if (offset % INSTRUCTION_SIZE == 0 && index < kEntryCount && mBlocks[index].IsValid())
+		{
+			return &mBlocks[index];
+		}
+		return nullptr;
+	}
+
+	// The native code slot of the block entered at address, or nullptr if no block
+	// can start there. Compiled blocks chain through it, so it is null whenever
+	// the block is invalid or uncompiled.
+	const BasicNativeBlockFunction<TCPU>* GetNativeCodeSlot(uint32_t address) const
+	{
+		const size_t index = (address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+		if (address >= PROGRAM_START_ADDRESS && address % INSTRUCTION_SIZE == 0 && index < kEntryCount)
+		{
+			return &mBlocks[index].mNativeCode;
+		}
+		return nullptr;
+	}
+
+	// Translates and caches the block starting at address, binding the handlers of
+	// the quirk policy. Returns nullptr if the first instruction cannot be fetched
+	// or decoded. Callers must Clear the cache when switching policy.
+	template <QuirkPolicy Quirks>
+	TranslatedBlock* Translate(uint16_t address, const TCPU& cpu, const BasicRAM<Geometry>& ram);
+
+	// Plain (unfused) handler for an opcode.
+	template <QuirkPolicy Quirks>
+	static typename MicroOp::Function GetHandler(OpcodeId opcodeId);
+
+	void Clear();
+	void ClearNativeCode();
+	void OnMemoryWritten(size_t address, size_t length) override;
+
+	uint64_t GetTranslationCount() const { return mTranslationCount; }
+
+private:
+	std::vector<TranslatedBlock> mBlocks;
+	uint64_t mTranslationCount = 0;
+};
+
+// The cache, block and op types for the default CPU
+using BlockCache = BasicBlockCache<CPU>;
+using MicroOp = BasicMicroOp<CPU>;
+using TranslatedBlock = BasicTranslatedBlock<CPU>;
+using NativeBlockFunction = BasicNativeBlockFunction<CPU>;
@@ -0,0 +1,166 @@
+#include "Interpreter/Engine/BlockEngine.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Interpreter.h"
+#include "Interpreter/Jit/JitCompiler.h"
+
+// System
+#include <algorithm>
+#include <cstdint>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// Rolls PC back to the op that failed or deferred and records why it stopped.
+	// Returns the final result (a deferred Fx0A still counts as a cycle).
+	template <typename TCPU>
+	RunResult StopAt(TCPU& cpu, uint16_t address, ExecutionStatus status, RunResult result)
+	{
+		cpu.SetProgramCounter(address);
+		result.mStatus = status;
+		if (status == ExecutionStatus::WaitingOnKeyPress)
+		{
+			result.mCyclesExecuted++;
+			return result;
+		}
+
+		result.mShouldHalt = true;
+		return result;
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TInterpreter>
+RunResult BlockEngine::Run(TInterpreter& interpreter, size_t cycleBudget, bool useJit)
+{
+	/*
+		Observable behaviour matches Interpreter::Step for every instruction. PC is
+		set past each op before it runs, so control flow ops see the value they
+		expect, and rolled back to the op if it fails or defers (Fx0A). A block is
+		cut short when the budget runs out mid-block.
+
+		The op that ends a block may write RAM and invalidate the block itself, so
+		nothing in the block is touched after the last op returns.
+
+		With the JIT enabled, blocks entered kHotBlockThreshold times are compiled
+		and run natively whenever the remaining budget covers the whole block.
+		Native code chains on through compiled successors and comes back with
+		PC on the next block to run, or on the op that failed.
+	*/
+
+	using TCPU = typename TInterpreter::CPUType;
+
+	TCPU& cpu = interpreter.mCPU;
+	BasicBlockCache<TCPU>& blockCache = interpreter.mBlockCache;
+	JitCompiler& jitCompiler = interpreter.mJitCompiler;
+	const BasicRAM<typename TCPU::GeometryType>& ram = interpreter.mBus.mRAM;
+
+	RunResult result;
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const uint16_t entry = cpu.GetProgramCounter();
+
+		BasicTranslatedBlock<TCPU>* block = blockCache.Find(entry);
+		if (block == nullptr)
+		{
+			block = blockCache.template Translate<Quirks>(entry, cpu, ram);
+		}
+
+		if (block == nullptr)
+		{
+			// Report the same fetch or decode failure as Step; PC has not moved
+			Instruction instruction;
+			result.mStatus = interpreter.FetchDecoded(instruction);
+			result.mShouldHalt = true;
+			return result;
+		}
+
+		const size_t remaining = cycleBudget - result.mCyclesExecuted;
+
+		if (useJit && block->mNativeCode == nullptr && ++block->mEntryCount >= JitCompiler::kHotBlockThreshold)
+		{
+			block->mNativeCode = jitCompiler.Compile<Quirks>(*block, entry, cpu, blockCache);
+			if (jitCompiler.IsFull())
+			{
+				// Out of code space: drop everything and let hot blocks recompile
+				blockCache.ClearNativeCode();
+				jitCompiler.Reset();
+			}
+		}
+
+		if (useJit && block->mNativeCode != nullptr && block->mOps.size() <= remaining)
+		{
+			const uint64_t budget = std::min<uint64_t>(remaining, JitCompiler::kMaxBudget);
+			const uint64_t native = block->mNativeCode(&cpu, &cpu.mState, budget);
+			const auto status = static_cast<ExecutionStatus>(native >> JitCompiler::kStatusShift);
+
+			result.mCyclesExecuted += static_cast<size_t>(budget - (native & JitCompiler::kBudgetMask));
+			if (status != ExecutionStatus::Executed)
+			{
+				return StopAt(cpu, cpu.GetProgramCounter(), status, result);
+			}
+			continue;
+		}
+
+		const BasicMicroOp<TCPU>* ops = block->mOps.data();
+		const size_t opCount = block->mOps.size();
+
+		if (opCount <= remaining)
+		{
+			// Whole block fits the budget: fused ops may run several instructions
+			for (size_t i = 0; i < opCount; )
+			{
+				const uint16_t address = static_cast<uint16_t>(entry + i * INSTRUCTION_SIZE);
+				cpu.SetProgramCounter(address + INSTRUCTION_SIZE);
+
+				const MicroOpResult op = ops[i].mExecute(cpu, ops[i]);
+				result.mCyclesExecuted += op.mRetired;
+				if (op.mStatus != ExecutionStatus::Executed)
+				{
+					// Instruction failed or deferred - roll back PC to retry it
+					return StopAt(cpu, static_cast<uint16_t>(address + op.mRetired * INSTRUCTION_SIZE), op.mStatus, result);
+				}
+
+				i += op.mLength;
+			}
+			continue;
+		}
+
+		// Budget ends inside the block: run plain handlers one instruction at a time
+		for (size_t i = 0; i < remaining; ++i)
+		{
+			const uint16_t address = static_cast<uint16_t>(entry + i * INSTRUCTION_SIZE);
+			cpu.SetProgramCounter(address + INSTRUCTION_SIZE);
+
+			const typename BasicMicroOp<TCPU>::Function handler = BasicBlockCache<TCPU>::template GetHandler<Quirks>(ops[i].mInstruction.GetOpcodeId());
+			const MicroOpResult op = handler(cpu, ops[i]);
+			if (op.mStatus != ExecutionStatus::Executed)
+			{
+				return StopAt(cpu, address, op.mStatus, result);
+			}
+
+			result.mCyclesExecuted++;
+
+			// A taken skip leaves the block before the jump it guards
+			if (cpu.GetProgramCounter() != address + INSTRUCTION_SIZE)
+			{
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+#define INSTANTIATE_RUN(Quirks, Geometry, TRandom) template RunResult BlockEngine::Run<Quirks>(BasicInterpreter<Geometry, TRandom>&, size_t, bool);
+#define INSTANTIATE_MACHINE(Geometry, TRandom) QUIRK_POLICY_LIST(INSTANTIATE_RUN, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_MACHINE)
+#undef INSTANTIATE_MACHINE
+#undef INSTANTIATE_RUN
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/Quirks.h"
+#include "Types/RunResult.h"
+
+// System
+#include <cstddef>
+
+// Basic-block execution engine. Code is translated once per entry PC into a run of
+// pre-bound micro-ops (see BlockCache), and each dispatch executes a whole block
+// without per-instruction fetch, PC validation or StepResult bookkeeping.
+// With useJit, hot blocks are compiled to native code (see JitCompiler).
+//--------------------------------------------------------------------------------
+class BlockEngine
+{
+public:
+	// Runs on a BasicInterpreter of any machine (see MACHINE_LIST)
+	template <QuirkPolicy Quirks, typename TInterpreter>
+	static RunResult Run(TInterpreter& interpreter, size_t cycleBudget, bool useJit);
+};
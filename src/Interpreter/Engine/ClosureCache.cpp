@@ -0,0 +1,246 @@
+#include "Interpreter/Engine/ClosureCache.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/CPUState.h"
+
+// System
+#include <algorithm>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// Plain function wrapper for ops without a specialised closure
+	template <typename TCPU, ExecutionStatus (TCPU::*Handler)(const Instruction&)>
+	ExecutionStatus InvokeHandler(TCPU& cpu, const BasicClosure<TCPU>& closure)
+	{
+		return (cpu.*Handler)(closure.mInstruction);
+	}
+
+	/*
+		Specialised closures. Each matches its CPU handler exactly; the engine
+		equivalence tests run every bundled ROM against the switch engine.
+	*/
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus JumpToImmediate(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		closure.mState->mProgramCounter = closure.mImmediate;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SkipIfEqualImmediate(TCPU& cpu, const BasicClosure<TCPU>& closure)
+	{
+		if (*closure.mVx == closure.mImmediate)
+		{
+			cpu.SkipNextInstruction();
+		}
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SkipIfNotEqualImmediate(TCPU& cpu, const BasicClosure<TCPU>& closure)
+	{
+		if (*closure.mVx != closure.mImmediate)
+		{
+			cpu.SkipNextInstruction();
+		}
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SkipIfEqualRegister(TCPU& cpu, const BasicClosure<TCPU>& closure)
+	{
+		if (*closure.mVx == *closure.mVy)
+		{
+			cpu.SkipNextInstruction();
+		}
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SkipIfNotEqualRegister(TCPU& cpu, const BasicClosure<TCPU>& closure)
+	{
+		if (*closure.mVx != *closure.mVy)
+		{
+			cpu.SkipNextInstruction();
+		}
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus LoadImmediate(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		*closure.mVx = static_cast<uint8_t>(closure.mImmediate);
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus AddImmediate(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		*closure.mVx = static_cast<uint8_t>(*closure.mVx + closure.mImmediate);
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus LoadRegister(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		*closure.mVx = *closure.mVy;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus AddRegister(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		const uint16_t sum = static_cast<uint16_t>(*closure.mVx + *closure.mVy);
+		*closure.mVx = static_cast<uint8_t>(sum & 0xFF);
+		closure.mState->mRegisters[FLAG_REGISTER_INDEX] = (sum > 255) ? 1 : 0;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SubtractRegister(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		const uint8_t vxValue = *closure.mVx;
+		const uint8_t vyValue = *closure.mVy;
+		*closure.mVx = static_cast<uint8_t>(vxValue - vyValue);
+		closure.mState->mRegisters[FLAG_REGISTER_INDEX] = (vxValue >= vyValue) ? 1 : 0;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus SubtractFromRegister(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		const uint8_t vxValue = *closure.mVx;
+		const uint8_t vyValue = *closure.mVy;
+		*closure.mVx = static_cast<uint8_t>(vyValue - vxValue);
+		closure.mState->mRegisters[FLAG_REGISTER_INDEX] = (vyValue >= vxValue) ? 1 : 0;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus LoadIndexImmediate(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		closure.mState->mIndexRegister = closure.mImmediate;
+		return ExecutionStatus::Executed;
+	}
+
+	//--------------------------------------------------------------------------------
+	template <typename TCPU>
+	ExecutionStatus AddIndexRegister(TCPU&, const BasicClosure<TCPU>& closure)
+	{
+		closure.mState->mIndexRegister = static_cast<uint16_t>(closure.mState->mIndexRegister + *closure.mVx);
+		return ExecutionStatus::Executed;
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+BasicClosureCache<TCPU>::BasicClosureCache()
+	: mEntries(kEntryCount + 1) // The last entry stays empty
+{ }
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+template <QuirkPolicy Quirks>
+auto BasicClosureCache<TCPU>::Compile(uint16_t address, const Instruction& instruction, TCPU& cpu) -> const Closure*
+{
+	static constexpr typename Closure::Function kHandlers[] = {
+		#define HANDLER_FUNCTION(pattern, mnemonic) &InvokeHandler<TCPU, &TCPU::Execute_##pattern##_##mnemonic>,
+		#define QUIRK_HANDLER_FUNCTION(pattern, mnemonic) &InvokeHandler<TCPU, &TCPU::template Execute_##pattern##_##mnemonic<Quirks>>,
+		OPCODE_HANDLER_LIST(HANDLER_FUNCTION, QUIRK_HANDLER_FUNCTION)
+		#undef QUIRK_HANDLER_FUNCTION
+		#undef HANDLER_FUNCTION
+	};
+
+	const OpcodeId opcodeId = instruction.GetOpcodeId();
+	typename TCPU::StateType& state = cpu.mState;
+
+	Closure& closure = mEntries[(address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE];
+	closure.mRun = kHandlers[static_cast<size_t>(opcodeId)];
+	closure.mVx = &state.mRegisters[instruction.GetOperandX()];
+	closure.mVy = &state.mRegisters[instruction.GetOperandY()];
+	closure.mState = &state;
+	closure.mImmediate = instruction.GetOperandKK();
+	closure.mInstruction = instruction;
+
+	switch (opcodeId)
+	{
+		case OpcodeId::JP_ADDR:    closure.mRun = &JumpToImmediate<TCPU>; closure.mImmediate = instruction.GetOperandNNN(); break;
+		case OpcodeId::SE_VX_KK:   closure.mRun = &SkipIfEqualImmediate<TCPU>; break;
+		case OpcodeId::SNE_VX_KK:  closure.mRun = &SkipIfNotEqualImmediate<TCPU>; break;
+		case OpcodeId::SE_VX_VY:   closure.mRun = &SkipIfEqualRegister<TCPU>; break;
+		case OpcodeId::LD_VX_KK:   closure.mRun = &LoadImmediate<TCPU>; break;
+		case OpcodeId::ADD_VX_KK:  closure.mRun = &AddImmediate<TCPU>; break;
+		case OpcodeId::LD_VX_VY:   closure.mRun = &LoadRegister<TCPU>; break;
+		case OpcodeId::ADD_VX_VY:  closure.mRun = &AddRegister<TCPU>; break;
+		case OpcodeId::SUB_VX_VY:  closure.mRun = &SubtractRegister<TCPU>; break;
+		case OpcodeId::SUBN_VX_VY: closure.mRun = &SubtractFromRegister<TCPU>; break;
+		case OpcodeId::SNE_VX_VY:  closure.mRun = &SkipIfNotEqualRegister<TCPU>; break;
+		case OpcodeId::LD_I_ADDR:  closure.mRun = &LoadIndexImmediate<TCPU>; closure.mImmediate = instruction.GetOperandNNN(); break;
+		case OpcodeId::ADD_I_VX:   closure.mRun = &AddIndexRegister<TCPU>; break;
+		default: break;
+	}
+
+	++mCompileCount;
+	return &closure;
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void BasicClosureCache<TCPU>::Clear()
+{
+	std::fill(mEntries.begin(), mEntries.end(), Closure{ });
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void BasicClosureCache<TCPU>::OnMemoryWritten(size_t address, size_t length)
+{
+	/*
+		Same invalidation window as InstructionCache: an entry at aligned address
+		A compiles bytes A and A + 1.
+	*/
+
+	const size_t end = address + length;
+	if (length == 0 || end <= PROGRAM_START_ADDRESS)
+	{
+		return;
+	}
+
+	const size_t first = (std::max<size_t>(address, PROGRAM_START_ADDRESS) - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+	const size_t last = std::min((end - 1 - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE, kEntryCount - 1);
+
+	for (size_t index = first; index <= last; ++index)
+	{
+		mEntries[index].mRun = nullptr;
+	}
+}
+
+// Explicit instantiations - one cache per machine and, on each, one compiler
+// per policy
+//--------------------------------------------------------------------------------
+#define INSTANTIATE_COMPILE(Quirks, Geometry, TRandom) \
+	template const BasicClosure<BasicCPU<Geometry, TRandom>>* BasicClosureCache<BasicCPU<Geometry, TRandom>>::Compile<Quirks>(uint16_t, const Instruction&, BasicCPU<Geometry, TRandom>&);
+#define INSTANTIATE_CLOSURE_CACHE(Geometry, TRandom) \
+	template class BasicClosureCache<BasicCPU<Geometry, TRandom>>; \
+	QUIRK_POLICY_LIST(INSTANTIATE_COMPILE, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_CLOSURE_CACHE)
+#undef INSTANTIATE_CLOSURE_CACHE
+#undef INSTANTIATE_COMPILE
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interfaces/IMemoryWriteListener.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Interpreter/Hardware/Quirks.h"
+#include "Interpreter/Instruction/Instruction.h"
+#include "Types/ExecutionStatus.h"
+
+// System
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One instruction compiled into a function pointer plus everything it needs. The
+// common register and immediate ops get their own function that works on the
+// captured operands directly: register operands are pointers into the CPU's
+// register file, so running the op involves no operand extraction or indexing.
+// Everything else is bound to the CPU handler, which reads mInstruction.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+struct BasicClosure
+{
+	using Function = ExecutionStatus (*)(TCPU& cpu, const BasicClosure& closure);
+
+	Function mRun = nullptr;
+	uint8_t* mVx = nullptr;
+	const uint8_t* mVy = nullptr;
+	typename TCPU::StateType* mState = nullptr; // For VF, PC and I
+	uint16_t mImmediate = 0; // kk or nnn, depending on the op
+	Instruction mInstruction;
+
+	bool IsValid() const { return mRun != nullptr; }
+};
+
+// Closures keyed by PC, built once per address on first execution. Entries
+// overlapping a RAM write are discarded, so self-modifying code is recompiled.
+// Closures capture pointers into one CPU, so a cache only ever serves that CPU,
+// and it covers that CPU's RAM.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+class BasicClosureCache : public IMemoryWriteListener
+{
+public:
+	using Closure = BasicClosure<TCPU>;
+
+	static constexpr size_t kEntryCount = (TCPU::GeometryType::kRamSize - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+
+	BasicClosureCache();
+
+	// Returns the closure for the address, or nullptr if none is cached. As with
+	// InstructionCache::Lookup, the address must be fetchable or kRamSize.
+	const Closure* Find(uint16_t address) const
+	{
+		const Closure& closure = mEntries[(address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE];
+		return closure.IsValid() ? &closure : nullptr;
+	}
+
+	// Binds a decoded instruction at a fetchable address (aligned, in the program
+	// region) to the quirk policy's handlers and caches it. Callers must Clear the
+	// cache when switching policy.
+	template <QuirkPolicy Quirks>
+	const Closure* Compile(uint16_t address, const Instruction& instruction, TCPU& cpu);
+
+	void Clear();
+	void OnMemoryWritten(size_t address, size_t length) override;
+
+	uint64_t GetCompileCount() const { return mCompileCount; }
+
+private:
+	std::vector<Closure> mEntries;
+	uint64_t mCompileCount = 0;
+};
+
+// The cache and closure types for the default CPU
+using ClosureCache = BasicClosureCache<CPU>;
+using Closure = BasicClosure<CPU>;
@@ -0,0 +1,82 @@
+#include "Interpreter/Engine/ClosureEngine.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Engine/ClosureCache.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Interpreter.h"
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TInterpreter>
+RunResult ClosureEngine::Run(TInterpreter& interpreter, size_t cycleBudget)
+{
+	/*
+		Mirrors Interpreter::Step for every instruction: PC only advances once a
+		closure exists for it, and is rolled back if the closure fails or defers.
+		A deferred instruction (Fx0A) still counts as a cycle.
+
+		Like Interpreter::FetchDecoded, PC is only validated after control flow;
+		anything the cache cannot serve goes through FetchDecoded.
+	*/
+
+	using TCPU = typename TInterpreter::CPUType;
+
+	TCPU& cpu = interpreter.mCPU;
+	BasicClosureCache<TCPU>& closureCache = interpreter.mClosureCache;
+
+	RunResult result;
+	uint16_t sequentialAddress = PROGRAM_START_ADDRESS;
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const uint16_t address = cpu.GetProgramCounter();
+
+		const bool isFetchable = (address == sequentialAddress || TCPU::IsFetchable(address));
+		const BasicClosure<TCPU>* closure = isFetchable ? closureCache.Find(address) : nullptr;
+		if (closure == nullptr)
+		{
+			Instruction instruction;
+			const ExecutionStatus fetchStatus = interpreter.FetchDecoded(instruction);
+			if (fetchStatus != ExecutionStatus::Executed)
+			{
+				// PC has not moved, so CPU state is preserved
+				result.mStatus = fetchStatus;
+				result.mShouldHalt = true;
+				return result;
+			}
+
+			closure = closureCache.template Compile<Quirks>(address, instruction, cpu);
+		}
+
+		sequentialAddress = TCPU::GetSequentialAddress(address);
+		cpu.SetProgramCounter(static_cast<uint16_t>(address + INSTRUCTION_SIZE));
+
+		const ExecutionStatus status = closure->mRun(cpu, *closure);
+		if (status != ExecutionStatus::Executed)
+		{
+			// Instruction failed or deferred - roll back PC to retry it
+			cpu.SetProgramCounter(address);
+			result.mStatus = status;
+			if (status == ExecutionStatus::WaitingOnKeyPress)
+			{
+				result.mCyclesExecuted++;
+				return result;
+			}
+
+			result.mShouldHalt = true;
+			return result;
+		}
+
+		result.mCyclesExecuted++;
+	}
+
+	return result;
+}
+
+#define INSTANTIATE_RUN(Quirks, Geometry, TRandom) template RunResult ClosureEngine::Run<Quirks>(BasicInterpreter<Geometry, TRandom>&, size_t);
+#define INSTANTIATE_MACHINE(Geometry, TRandom) QUIRK_POLICY_LIST(INSTANTIATE_RUN, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_MACHINE)
+#undef INSTANTIATE_MACHINE
+#undef INSTANTIATE_RUN
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/Quirks.h"
+#include "Types/RunResult.h"
+
+// System
+#include <cstddef>
+
+// Closure-compilation engine. Each instruction is compiled once into a closure
+// (see ClosureCache) with its operands captured, so running it is one indirect
+// call. Unlike the threaded engine it needs no compiler extensions, and unlike
+// the block engine it dispatches per instruction with no block bookkeeping.
+//--------------------------------------------------------------------------------
+class ClosureEngine
+{
+public:
+	// Runs on a BasicInterpreter of any machine (see MACHINE_LIST)
+	template <QuirkPolicy Quirks, typename TInterpreter>
+	static RunResult Run(TInterpreter& interpreter, size_t cycleBudget);
+};
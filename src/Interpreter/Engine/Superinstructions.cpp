@@ -0,0 +1,166 @@
+#include "Interpreter/Engine/Superinstructions.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+
+// System
+#include <cstddef>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	template <typename TCPU>
+	bool IsOpcode(const std::vector<BasicMicroOp<TCPU>>& ops, size_t index, OpcodeId opcodeId)
+	{
+		return index < ops.size() && ops[index].mInstruction.GetOpcodeId() == opcodeId;
+	}
+
+	template <typename TCPU>
+	bool IsSkipOnKK(const std::vector<BasicMicroOp<TCPU>>& ops, size_t index)
+	{
+		return IsOpcode(ops, index, OpcodeId::SE_VX_KK) || IsOpcode(ops, index, OpcodeId::SNE_VX_KK);
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TCPU>
+void Superinstructions::Fuse(std::vector<BasicMicroOp<TCPU>>& ops)
+{
+	/*
+		Sequences are matched greedily from the start of the block, longest first.
+		The engine sets PC past the first instruction before a fused op runs; the
+		fused op advances PC past every further instruction it runs, exactly as the
+		engine would between separate ops.
+	*/
+
+	size_t index = 0;
+	while (index < ops.size())
+	{
+		BasicMicroOp<TCPU>& op = ops[index];
+		size_t length = 1;
+
+		if (IsOpcode(ops, index, OpcodeId::LD_VX_KK) && IsOpcode(ops, index + 1, OpcodeId::LD_VX_KK))
+		{
+			op.mExecute = &Execute_6xkk_6xkk<TCPU>;
+			length = 2;
+		}
+		else if (IsOpcode(ops, index, OpcodeId::LD_I_ADDR) && IsOpcode(ops, index + 1, OpcodeId::DRW_VX_VY_N))
+		{
+			op.mExecute = &Execute_Annn_Dxyn<Quirks, TCPU>;
+			length = 2;
+		}
+		else if (IsSkipOnKK(ops, index) && IsOpcode(ops, index + 1, OpcodeId::JP_ADDR))
+		{
+			const bool skipIfEqual = IsOpcode(ops, index, OpcodeId::SE_VX_KK);
+			op.mExecute = skipIfEqual ? &Execute_Skip_1nnn<true, TCPU> : &Execute_Skip_1nnn<false, TCPU>;
+			length = 2;
+		}
+		else if (IsOpcode(ops, index, OpcodeId::ADD_VX_KK) && IsSkipOnKK(ops, index + 1))
+		{
+			const bool skipIfEqual = IsOpcode(ops, index + 1, OpcodeId::SE_VX_KK);
+			if (IsOpcode(ops, index + 2, OpcodeId::JP_ADDR))
+			{
+				op.mExecute = skipIfEqual ? &Execute_7xkk_Skip_1nnn<true, TCPU> : &Execute_7xkk_Skip_1nnn<false, TCPU>;
+				length = 3;
+			}
+			else
+			{
+				op.mExecute = skipIfEqual ? &Execute_7xkk_Skip<true, TCPU> : &Execute_7xkk_Skip<false, TCPU>;
+				length = 2;
+			}
+		}
+
+		index += length;
+	}
+}
+
+// Set Vx = kk; set Vy = kk.
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+MicroOpResult Superinstructions::Execute_6xkk_6xkk(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+{
+	const Instruction& first = op.mInstruction;
+	const Instruction& second = (&op)[1].mInstruction;
+
+	cpu.mState.mRegisters[first.GetOperandX()] = first.GetOperandKK();
+	cpu.mState.mRegisters[second.GetOperandX()] = second.GetOperandKK();
+	cpu.mState.mProgramCounter += INSTRUCTION_SIZE;
+
+	return { ExecutionStatus::Executed, 2, 2 };
+}
+
+// Set I = nnn; draw n-byte sprite at (Vx, Vy).
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TCPU>
+MicroOpResult Superinstructions::Execute_Annn_Dxyn(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+{
+	cpu.mState.mIndexRegister = op.mInstruction.GetOperandNNN();
+	cpu.mState.mProgramCounter += INSTRUCTION_SIZE;
+
+	const ExecutionStatus status = cpu.template Execute_Dxyn_DRW_VX_VY_N<Quirks>((&op)[1].mInstruction);
+	return { status, static_cast<uint8_t>(status == ExecutionStatus::Executed ? 2 : 1), 2 };
+}
+
+// Skip the jump to nnn if Vx = kk (Vx != kk for 4xkk), otherwise take it.
+//--------------------------------------------------------------------------------
+template <bool kSkipIfEqual, typename TCPU>
+MicroOpResult Superinstructions::Execute_Skip_1nnn(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+{
+	const Instruction& skip = op.mInstruction;
+	const bool isEqual = cpu.mState.mRegisters[skip.GetOperandX()] == skip.GetOperandKK();
+
+	if (isEqual == kSkipIfEqual)
+	{
+		cpu.mState.mProgramCounter += INSTRUCTION_SIZE;
+		return { ExecutionStatus::Executed, 1, 2 };
+	}
+
+	cpu.mState.mProgramCounter = (&op)[1].mInstruction.GetOperandNNN();
+	return { ExecutionStatus::Executed, 2, 2 };
+}
+
+// Set Vx = Vx + kk; skip the next instruction on the 3xkk/4xkk test that follows.
+//--------------------------------------------------------------------------------
+template <bool kSkipIfEqual, typename TCPU>
+MicroOpResult Superinstructions::Execute_7xkk_Skip(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+{
+	const Instruction& add = op.mInstruction;
+	const Instruction& skip = (&op)[1].mInstruction;
+
+	cpu.mState.mRegisters[add.GetOperandX()] += add.GetOperandKK();
+	cpu.mState.mProgramCounter += INSTRUCTION_SIZE;
+
+	const bool isEqual = cpu.mState.mRegisters[skip.GetOperandX()] == skip.GetOperandKK();
+	if (isEqual == kSkipIfEqual)
+	{
+		cpu.SkipNextInstruction();
+	}
+
+	return { ExecutionStatus::Executed, 2, 2 };
+}
+
+// Set Vx = Vx + kk; then the 3xkk/4xkk guarded jump to nnn.
+//--------------------------------------------------------------------------------
+template <bool kSkipIfEqual, typename TCPU>
+MicroOpResult Superinstructions::Execute_7xkk_Skip_1nnn(TCPU& cpu, const BasicMicroOp<TCPU>& op)
+{
+	const Instruction& add = op.mInstruction;
+	cpu.mState.mRegisters[add.GetOperandX()] += add.GetOperandKK();
+	cpu.mState.mProgramCounter += INSTRUCTION_SIZE;
+
+	MicroOpResult result = Execute_Skip_1nnn<kSkipIfEqual, TCPU>(cpu, (&op)[1]);
+	result.mRetired++;
+	result.mLength++;
+	return result;
+}
+
+#define INSTANTIATE_FUSE(Quirks, Geometry, TRandom) template void Superinstructions::Fuse<Quirks>(std::vector<BasicMicroOp<BasicCPU<Geometry, TRandom>>>&);
+#define INSTANTIATE_MACHINE(Geometry, TRandom) QUIRK_POLICY_LIST(INSTANTIATE_FUSE, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_MACHINE)
+#undef INSTANTIATE_MACHINE
+#undef INSTANTIATE_FUSE
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Hardware/Quirks.h"
+
+// System
+#include <vector>
+
+// Fuses recurring opcode sequences of a translated block into single micro-ops:
+//
+//   6xkk 6xkk       two register loads
+//   Annn Dxyn       point I at a sprite and draw it
+//   3xkk/4xkk 1nnn  conditional jump
+//   7xkk 3xkk/4xkk  loop counter test, optionally followed by its 1nnn
+//
+// The fused op replaces the handler of the first op of the sequence. The ops it
+// covers keep their plain handlers, so a block can still be run one op at a time.
+//--------------------------------------------------------------------------------
+class Superinstructions
+{
+public:
+	template <QuirkPolicy Quirks, typename TCPU>
+	static void Fuse(std::vector<BasicMicroOp<TCPU>>& ops);
+
+private:
+	template <typename TCPU>
+	static MicroOpResult Execute_6xkk_6xkk(TCPU& cpu, const BasicMicroOp<TCPU>& op);
+	template <QuirkPolicy Quirks, typename TCPU>
+	static MicroOpResult Execute_Annn_Dxyn(TCPU& cpu, const BasicMicroOp<TCPU>& op);
+	template <bool kSkipIfEqual, typename TCPU>
+	static MicroOpResult Execute_Skip_1nnn(TCPU& cpu, const BasicMicroOp<TCPU>& op);
+	template <bool kSkipIfEqual, typename TCPU>
+	static MicroOpResult Execute_7xkk_Skip(TCPU& cpu, const BasicMicroOp<TCPU>& op);
+	template <bool kSkipIfEqual, typename TCPU>
+	static MicroOpResult Execute_7xkk_Skip_1nnn(TCPU& cpu, const BasicMicroOp<TCPU>& op);
+};
@@ -0,0 +1,174 @@
+#include "Interpreter/Engine/ThreadedEngine.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+#include "Interpreter/Interpreter.h"
+
+// System
+#include <cstddef>
+#include <iterator>
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define THREADED_ENGINE_USE_COMPUTED_GOTO 1
+#else
+	#define THREADED_ENGINE_USE_COMPUTED_GOTO 0
+#endif
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	// Dispatch tables are indexed by OpcodeId, so the handler list must follow the enum
+	#define OPCODE_ID_ENTRY(pattern, mnemonic) OpcodeId::mnemonic,
+	constexpr OpcodeId kHandlerOrder[] = { OPCODE_HANDLER_LIST(OPCODE_ID_ENTRY, OPCODE_ID_ENTRY) };
+	#undef OPCODE_ID_ENTRY
+
+	constexpr bool IsHandlerListInOpcodeIdOrder()
+	{
+		for (size_t i = 0; i < std::size(kHandlerOrder); ++i)
+		{
+			if (static_cast<size_t>(kHandlerOrder[i]) != i)
+			{
+				return false;
+			}
+		}
+		return std::size(kHandlerOrder) == static_cast<size_t>(OpcodeId::UNASSIGNED);
+	}
+
+	static_assert(IsHandlerListInOpcodeIdOrder(), "OPCODE_HANDLER_LIST must cover every OpcodeId in order");
+}
+
+#if THREADED_ENGINE_USE_COMPUTED_GOTO && defined(__GNUC__)
+	// Labels-as-values are a GNU extension
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TInterpreter>
+RunResult ThreadedEngine::Run(TInterpreter& interpreter, size_t cycleBudget)
+{
+	/*
+		Mirrors Interpreter::Step for every instruction: PC only advances once the
+		instruction is fetched and decoded, and is rolled back if the handler fails
+		or defers. A deferred instruction (Fx0A) still counts as a cycle.
+	*/
+
+	using TCPU = typename TInterpreter::CPUType;
+
+	TCPU& cpu = interpreter.mCPU;
+	typename TCPU::StateType& state = cpu.mState;
+
+	RunResult result;
+	Instruction instruction;
+	ExecutionStatus status = ExecutionStatus::Executed;
+	uint16_t pcBeforeFetch = 0;
+
+#if THREADED_ENGINE_USE_COMPUTED_GOTO
+	static void* const kDispatchTable[] = {
+		#define HANDLER_LABEL_ADDRESS(pattern, mnemonic) &&Handle_##mnemonic,
+		OPCODE_HANDLER_LIST(HANDLER_LABEL_ADDRESS, HANDLER_LABEL_ADDRESS)
+		#undef HANDLER_LABEL_ADDRESS
+	};
+
+	#define DISPATCH_NEXT()                                                          \
+		if (result.mCyclesExecuted == cycleBudget)                                   \
+		{                                                                            \
+			return result;                                                           \
+		}                                                                            \
+		pcBeforeFetch = state.mProgramCounter;                                       \
+		status = interpreter.FetchDecoded(instruction);                              \
+		if (status != ExecutionStatus::Executed)                                     \
+		{                                                                            \
+			goto FetchFailed;                                                        \
+		}                                                                            \
+		state.mProgramCounter = pcBeforeFetch + INSTRUCTION_SIZE;                    \
+		goto *kDispatchTable[static_cast<size_t>(instruction.GetOpcodeId())]
+
+	#define HANDLER_LABEL_WITH_CALL(mnemonic, call)                                  \
+		Handle_##mnemonic:                                                           \
+			status = call;                                                           \
+			if (status != ExecutionStatus::Executed)                                 \
+			{                                                                        \
+				goto ExecuteFailed;                                                  \
+			}                                                                        \
+			result.mCyclesExecuted++;                                                \
+			DISPATCH_NEXT();
+
+	#define HANDLER_LABEL(pattern, mnemonic)                                         \
+		HANDLER_LABEL_WITH_CALL(mnemonic, cpu.Execute_##pattern##_##mnemonic(instruction))
+	#define QUIRK_HANDLER_LABEL(pattern, mnemonic)                                   \
+		HANDLER_LABEL_WITH_CALL(mnemonic, cpu.template Execute_##pattern##_##mnemonic<Quirks>(instruction))
+
+	DISPATCH_NEXT();
+	OPCODE_HANDLER_LIST(HANDLER_LABEL, QUIRK_HANDLER_LABEL)
+
+	#undef QUIRK_HANDLER_LABEL
+	#undef HANDLER_LABEL
+	#undef HANDLER_LABEL_WITH_CALL
+	#undef DISPATCH_NEXT
+#else
+	using Handler = ExecutionStatus (TCPU::*)(const Instruction&);
+	static constexpr Handler kHandlerTable[] = {
+		#define HANDLER_ADDRESS(pattern, mnemonic) &TCPU::Execute_##pattern##_##mnemonic,
+		#define QUIRK_HANDLER_ADDRESS(pattern, mnemonic) &TCPU::template Execute_##pattern##_##mnemonic<Quirks>,
+		OPCODE_HANDLER_LIST(HANDLER_ADDRESS, QUIRK_HANDLER_ADDRESS)
+		#undef QUIRK_HANDLER_ADDRESS
+		#undef HANDLER_ADDRESS
+	};
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		pcBeforeFetch = state.mProgramCounter;
+		status = interpreter.FetchDecoded(instruction);
+		if (status != ExecutionStatus::Executed)
+		{
+			goto FetchFailed;
+		}
+
+		state.mProgramCounter = pcBeforeFetch + INSTRUCTION_SIZE;
+		status = (cpu.*kHandlerTable[static_cast<size_t>(instruction.GetOpcodeId())])(instruction);
+		if (status != ExecutionStatus::Executed)
+		{
+			goto ExecuteFailed;
+		}
+
+		result.mCyclesExecuted++;
+	}
+
+	return result;
+#endif
+
+FetchFailed:
+	// PC has not moved, so CPU state is preserved
+	result.mStatus = status;
+	result.mShouldHalt = true;
+	return result;
+
+ExecuteFailed:
+	// Instruction failed or deferred - roll back PC to retry it
+	state.mProgramCounter = pcBeforeFetch;
+	result.mStatus = status;
+	if (status == ExecutionStatus::WaitingOnKeyPress)
+	{
+		result.mCyclesExecuted++;
+		return result;
+	}
+
+	result.mShouldHalt = true;
+	return result;
+}
+
+#if THREADED_ENGINE_USE_COMPUTED_GOTO && defined(__GNUC__)
+	#pragma GCC diagnostic pop
+#endif
+
+#define INSTANTIATE_RUN(Quirks, Geometry, TRandom) template RunResult ThreadedEngine::Run<Quirks>(BasicInterpreter<Geometry, TRandom>&, size_t);
+#define INSTANTIATE_MACHINE(Geometry, TRandom) QUIRK_POLICY_LIST(INSTANTIATE_RUN, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_MACHINE)
+#undef INSTANTIATE_MACHINE
+#undef INSTANTIATE_RUN
\ No newline at end of file
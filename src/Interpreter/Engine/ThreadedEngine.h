@@ -0,0 +1,26 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/Quirks.h"
+#include "Types/RunResult.h"
+
+// System
+#include <cstddef>
+
+// Direct-threaded execution engine. Each opcode handler ends by fetching the next
+// instruction and jumping straight to its handler, so there is no central switch
+// and no per-instruction StepResult bookkeeping.
+//
+// GCC and Clang use labels-as-values (computed goto). Other compilers fall back to
+// a table of handler pointers indexed by OpcodeId. Each quirk policy gets its own
+// instantiation, so quirk-dependent handlers are dispatched to directly.
+//--------------------------------------------------------------------------------
+class ThreadedEngine
+{
+public:
+	// Runs on a BasicInterpreter of any machine (see MACHINE_LIST)
+	template <QuirkPolicy Quirks, typename TInterpreter>
+	static RunResult Run(TInterpreter& interpreter, size_t cycleBudget);
+};
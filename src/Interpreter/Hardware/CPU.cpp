@@ -6,6 +6,7 @@
 #include "Constants.h"
 #include "Interpreter/Hardware/DelayTimer.h"
 #include "Interpreter/Hardware/Display.h"
+#include "Interpreter/Instruction/DecodeTable.h"
 #include "Interpreter/Instruction/Instruction.h"
 #include "Interpreter/Instruction/OpcodeTable.h"
 #include "Interpreter/Hardware/Keypad.h"
@@ -13,18 +14,24 @@
 #include "Interpreter/Hardware/SoundTimer.h"
 
 // System
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <span>
 
 //--------------------------------------------------------------------------------
-CPU::CPU(Bus& bus, IRandomProvider& randomProvider)
+template <typename Geometry, RandomSource TRandom>
+BasicCPU<Geometry, TRandom>::BasicCPU(BusType& bus, TRandom& randomSource)
     : mBus{ bus }
-    , mRandomProvider(randomProvider)
+    , mRandomSource(randomSource)
 { 
     mState.mProgramCounter = PROGRAM_START_ADDRESS;
+    BindPolicy();
 }
 
 //--------------------------------------------------------------------------------
-void CPU::Reset()
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::Reset()
 {
     mState.mProgramCounter = PROGRAM_START_ADDRESS;
     mState.mIndexRegister = 0;
@@ -36,7 +43,8 @@ void CPU::Reset()
 }
 
 //--------------------------------------------------------------------------------
-void CPU::DecrementTimers()
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::DecrementTimers()
 {
     if (mState.mDelayTimer > 0)
     {
@@ -50,7 +58,8 @@ void CPU::DecrementTimers()
 }
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] FetchResult CPU::Peek() const
+template <typename Geometry, RandomSource TRandom>
+[[nodiscard]] FetchResult BasicCPU<Geometry, TRandom>::Peek() const
 {
     FetchResult result;
 
@@ -63,7 +72,7 @@ void CPU::DecrementTimers()
         return result;
     }
 
-    if (address < PROGRAM_START_ADDRESS || (address + 1) >= RAM_SIZE)
+    if (address < PROGRAM_START_ADDRESS || address >= Geometry::kRamSize - 1)
     {
         result.mStatus = ExecutionStatus::InvalidAddressOutOfBounds;
         result.mIsValidAddress = false;
@@ -78,7 +87,8 @@ void CPU::DecrementTimers()
 }
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] FetchResult CPU::Fetch()
+template <typename Geometry, RandomSource TRandom>
+[[nodiscard]] FetchResult BasicCPU<Geometry, TRandom>::Fetch()
 {
 	FetchResult result = Peek();
 	mState.mProgramCounter += INSTRUCTION_SIZE;
@@ -87,31 +97,60 @@ void CPU::DecrementTimers()
 }
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] Instruction CPU::Decode(uint16_t opcode) const
+template <typename Geometry, RandomSource TRandom>
+[[nodiscard]] Instruction BasicCPU<Geometry, TRandom>::Decode(uint16_t opcode) const
 {
-    for (const OpcodeSpec& opcodeSpec : OpcodeTable::All())
+    // Precomputed table lookup, equivalent to the most specific spec in OpcodeTable::All()
+    // where (opcode & mask) == pattern, e.g. (0x8123 & 0xF00F) == 0x8003 for XOR_VX_VY
+    const OpcodeId opcodeId = (*mDecodeTable)[opcode];
+    if (opcodeId == OpcodeId::UNASSIGNED)
     {
-        // Apply the mask to isolate pattern-relevant bits, then compare to expected pattern
-        // e.g. (0x8123 & 0xF00F) == 0x8003 for XOR_VX_VY
-        if ((opcode & opcodeSpec.mMask) == opcodeSpec.mPattern)
-        {
-            // Parse opcode operands
-            std::vector<uint16_t> operands;            
-            for (const auto& operandSpec : opcodeSpec.mOperands)
-            {
-                uint16_t value = (opcode & operandSpec.mMask) >> operandSpec.mShift;
-                operands.push_back(value);
-            }
-        
-            return { opcodeSpec.mOpcodeId, operands };            
-        }
+        return { }; // Decode failed, return an empty instruction
     }
 
-	return { }; // Decode failed, return an empty instruction
+    // Operands are extracted into fixed inline fields (no allocation)
+    return { opcodeId, opcode };
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::SetQuirkProfile(QuirkProfile profile)
+{
+    mQuirkProfile = profile;
+    BindPolicy();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::SetExecutionMode(ExecutionMode mode)
+{
+    mExecutionMode = mode;
+    BindPolicy();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::SetInstructionSet(InstructionSet instructionSet)
+{
+    mInstructionSet = instructionSet;
+    mDecodeTable = &DecodeTable::Get(instructionSet);
+    mHasLongInstructions = OpcodeTable::Get(OpcodeId::LD_I_LONG).IsPartOf(instructionSet);
 }
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] ExecutionStatus CPU::Execute(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+void BasicCPU<Geometry, TRandom>::BindPolicy()
+{
+    mExecute = VisitQuirkPolicy(mQuirkProfile, mExecutionMode, [] <QuirkPolicy Quirks> () -> ExecuteFunction
+    {
+        return &BasicCPU::Execute<Quirks>;
+    });
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+[[nodiscard]] ExecutionStatus BasicCPU<Geometry, TRandom>::Execute(const Instruction& instruction)
 {
     assert(instruction.IsValid());
 
@@ -121,39 +160,57 @@ void CPU::DecrementTimers()
     {
         case OpcodeId::SYS_ADDR:    status = Execute_0nnn_SYS_ADDR(instruction); break;
         case OpcodeId::CLS:         status = Execute_00E0_CLS(instruction); break;
-        case OpcodeId::RET:         status = Execute_00EE_RET(instruction); break;
+        case OpcodeId::RET:         status = Execute_00EE_RET<Quirks>(instruction); break;
         case OpcodeId::JP_ADDR:     status = Execute_1nnn_JP_ADDR(instruction); break;
-        case OpcodeId::CALL_ADDR:   status = Execute_2nnn_CALL_ADDR(instruction); break;
+        case OpcodeId::CALL_ADDR:   status = Execute_2nnn_CALL_ADDR<Quirks>(instruction); break;
         case OpcodeId::SE_VX_KK:    status = Execute_3xkk_SE_VX_KK(instruction); break;
         case OpcodeId::SNE_VX_KK:   status = Execute_4xkk_SNE_VX_KK(instruction); break;
         case OpcodeId::SE_VX_VY:    status = Execute_5xy0_SE_VX_VY(instruction); break;
         case OpcodeId::LD_VX_KK:    status = Execute_6xkk_LD_VX_KK(instruction); break;
         case OpcodeId::ADD_VX_KK:   status = Execute_7xkk_ADD_VX_KK(instruction); break;
         case OpcodeId::LD_VX_VY:    status = Execute_8xy0_LD_VX_VY(instruction); break;
-        case OpcodeId::OR_VX_VY:    status = Execute_8xy1_OR_VX_VY(instruction); break;
-        case OpcodeId::AND_VX_VY:   status = Execute_8xy2_AND_VX_VY(instruction); break;
-        case OpcodeId::XOR_VX_VY:   status = Execute_8xy3_XOR_VX_VY(instruction); break;
+        case OpcodeId::OR_VX_VY:    status = Execute_8xy1_OR_VX_VY<Quirks>(instruction); break;
+        case OpcodeId::AND_VX_VY:   status = Execute_8xy2_AND_VX_VY<Quirks>(instruction); break;
+        case OpcodeId::XOR_VX_VY:   status = Execute_8xy3_XOR_VX_VY<Quirks>(instruction); break;
         case OpcodeId::ADD_VX_VY:   status = Execute_8xy4_ADD_VX_VY(instruction); break;
         case OpcodeId::SUB_VX_VY:   status = Execute_8xy5_SUB_VX_VY(instruction); break;
-        case OpcodeId::SHR_VX_VY:   status = Execute_8xy6_SHR_VX_VY(instruction); break;
+        case OpcodeId::SHR_VX_VY:   status = Execute_8xy6_SHR_VX_VY<Quirks>(instruction); break;
         case OpcodeId::SUBN_VX_VY:  status = Execute_8xy7_SUBN_VX_VY(instruction); break;
-        case OpcodeId::SHL_VX_VY:   status = Execute_8xyE_SHL_VX_VY(instruction); break;
+        case OpcodeId::SHL_VX_VY:   status = Execute_8xyE_SHL_VX_VY<Quirks>(instruction); break;
         case OpcodeId::SNE_VX_VY:   status = Execute_9xy0_SNE_VX_VY(instruction); break;
         case OpcodeId::LD_I_ADDR:   status = Execute_Annn_LD_I_ADDR(instruction); break;
-        case OpcodeId::JP_V0_ADDR:  status = Execute_Bnnn_JP_V0_ADDR(instruction); break;
-        case OpcodeId::RND_VX_KK:   status = Execute_Cxkk_RND_VX_KK(instruction); break;
-        case OpcodeId::DRW_VX_VY_N: status = Execute_Dxyn_DRW_VX_VY_N(instruction); break;
-        case OpcodeId::SKP_VX:      status = Execute_Ex9E_SKP_VX(instruction); break;
-        case OpcodeId::SKNP_VX:     status = Execute_ExA1_SKNP_VX(instruction); break;
+        case OpcodeId::JP_V0_ADDR:  status = Execute_Bnnn_JP_V0_ADDR<Quirks>(instruction); break;
+        case OpcodeId::RND_VX_KK:   status = Execute_Cxkk_RND_VX_KK<Quirks>(instruction); break;
+        case OpcodeId::DRW_VX_VY_N: status = Execute_Dxyn_DRW_VX_VY_N<Quirks>(instruction); break;
+        case OpcodeId::SKP_VX:      status = Execute_Ex9E_SKP_VX<Quirks>(instruction); break;
+        case OpcodeId::SKNP_VX:     status = Execute_ExA1_SKNP_VX<Quirks>(instruction); break;
         case OpcodeId::LD_VX_DT:    status = Execute_Fx07_LD_VX_DT(instruction); break;
         case OpcodeId::LD_VX_K:     status = Execute_Fx0A_LD_VX_K(instruction); break;
         case OpcodeId::LD_DT_VX:    status = Execute_Fx15_LD_DT_VX(instruction); break;
         case OpcodeId::LD_ST_VX:    status = Execute_Fx18_LD_ST_VX(instruction); break;
         case OpcodeId::ADD_I_VX:    status = Execute_Fx1E_ADD_I_VX(instruction); break;
-        case OpcodeId::LD_F_VX:     status = Execute_Fx29_LD_F_VX(instruction); break;
-        case OpcodeId::LD_B_VX:     status = Execute_Fx33_LD_B_VX(instruction); break;
-        case OpcodeId::LD_I_VX:     status = Execute_Fx55_LD_I_VX(instruction); break;
-        case OpcodeId::LD_VX_I:     status = Execute_Fx65_LD_VX_I(instruction); break;
+        case OpcodeId::LD_F_VX:     status = Execute_Fx29_LD_F_VX<Quirks>(instruction); break;
+        case OpcodeId::LD_B_VX:     status = Execute_Fx33_LD_B_VX<Quirks>(instruction); break;
+        case OpcodeId::LD_I_VX:     status = Execute_Fx55_LD_I_VX<Quirks>(instruction); break;
+        case OpcodeId::LD_VX_I:     status = Execute_Fx65_LD_VX_I<Quirks>(instruction); break;
+        case OpcodeId::SCD_N:       status = Execute_00Cn_SCD_N(instruction); break;
+        case OpcodeId::SCR:         status = Execute_00FB_SCR(instruction); break;
+        case OpcodeId::SCL:         status = Execute_00FC_SCL(instruction); break;
+        case OpcodeId::EXIT:        status = Execute_00FD_EXIT(instruction); break;
+        case OpcodeId::LOW:         status = Execute_00FE_LOW(instruction); break;
+        case OpcodeId::HIGH:        status = Execute_00FF_HIGH(instruction); break;
+        case OpcodeId::DRW16_VX_VY: status = Execute_Dxy0_DRW16_VX_VY<Quirks>(instruction); break;
+        case OpcodeId::LD_HF_VX:    status = Execute_Fx30_LD_HF_VX<Quirks>(instruction); break;
+        case OpcodeId::LD_R_VX:     status = Execute_Fx75_LD_R_VX(instruction); break;
+        case OpcodeId::LD_VX_R:     status = Execute_Fx85_LD_VX_R(instruction); break;
+        case OpcodeId::SCU_N:       status = Execute_00Dn_SCU_N(instruction); break;
+        case OpcodeId::LD_I_VX_VY:  status = Execute_5xy2_LD_I_VX_VY<Quirks>(instruction); break;
+        case OpcodeId::LD_VX_VY_I:  status = Execute_5xy3_LD_VX_VY_I<Quirks>(instruction); break;
+        case OpcodeId::LD_I_LONG:   status = Execute_F000_LD_I_LONG<Quirks>(instruction); break;
+        case OpcodeId::PLANE_N:     status = Execute_Fn01_PLANE_N(instruction); break;
+        case OpcodeId::AUDIO:       status = Execute_F002_AUDIO<Quirks>(instruction); break;
+        case OpcodeId::LD_PITCH_VX: status = Execute_Fx3A_LD_PITCH_VX(instruction); break;
+        case OpcodeId::UNASSIGNED:  break; // Decode never produces it (asserted above)
     } 
 
     return status;
@@ -161,7 +218,8 @@ void CPU::DecrementTimers()
 
 // Jump to a machine code routine at nnn.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_0nnn_SYS_ADDR(const Instruction&)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_0nnn_SYS_ADDR(const Instruction&)
 {
     /*
         NOTE: Legacy SYS instruction (0nnn); ignored in modern interpreters.        
@@ -172,7 +230,8 @@ ExecutionStatus CPU::Execute_0nnn_SYS_ADDR(const Instruction&)
 
 // Clear the display.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_00E0_CLS(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00E0_CLS(const Instruction& instruction)
 {
 	(void)instruction; // Unused parameter
 	mBus.mDisplay.Clear();
@@ -182,17 +241,28 @@ ExecutionStatus CPU::Execute_00E0_CLS(const Instruction& instruction)
 
 // Return from a subroutine.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_00EE_RET(const Instruction&)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00EE_RET(const Instruction&)
 {   
+    if constexpr (Quirks::kIsChecked)
+    {
+        if (mState.mStackPointer == 0)
+        {
+            return ExecutionStatus::StackUnderflow;
+        }
+    }
+
     mState.mStackPointer--;
-    mState.mProgramCounter = mState.mStack[mState.mStackPointer];    
+    mState.mProgramCounter = mState.mStack[mState.mStackPointer & Geometry::kStackIndexMask];    
 
     return ExecutionStatus::Executed;
 }
 
 // Jump to location nnn.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_1nnn_JP_ADDR(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_1nnn_JP_ADDR(const Instruction& instruction)
 {
     const uint16_t address = instruction.GetOperandNNN();
     mState.mProgramCounter = address;
@@ -202,11 +272,21 @@ ExecutionStatus CPU::Execute_1nnn_JP_ADDR(const Instruction& instruction)
 
 // Call subroutine at nnn.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_2nnn_CALL_ADDR(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_2nnn_CALL_ADDR(const Instruction& instruction)
 {
     const uint16_t address = instruction.GetOperandNNN();
 
-    mState.mStack[mState.mStackPointer] = mState.mProgramCounter;
+    if constexpr (Quirks::kIsChecked)
+    {
+        if (mState.mStackPointer >= Geometry::kStackSize)
+        {
+            return ExecutionStatus::StackOverflow;
+        }
+    }
+
+    mState.mStack[mState.mStackPointer & Geometry::kStackIndexMask] = mState.mProgramCounter;
     mState.mStackPointer++;
     mState.mProgramCounter = address;
  
@@ -215,14 +295,15 @@ ExecutionStatus CPU::Execute_2nnn_CALL_ADDR(const Instruction& instruction)
 
 // Skip next instruction if Vx = kk.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_3xkk_SE_VX_KK(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_3xkk_SE_VX_KK(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const uint8_t kkValue = instruction.GetOperandKK();
         
-    if (mState.mRegisters.at(vxReg) == kkValue)
+    if (mState.mRegisters[vxReg] == kkValue)
     {
-        mState.mProgramCounter += INSTRUCTION_SIZE;
+        SkipNextInstruction();
     }
 
     return ExecutionStatus::Executed;
@@ -230,14 +311,15 @@ ExecutionStatus CPU::Execute_3xkk_SE_VX_KK(const Instruction& instruction)
 
 // Skip next instruction if Vx != kk.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_4xkk_SNE_VX_KK(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_4xkk_SNE_VX_KK(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const uint8_t kkValue = instruction.GetOperandKK();    
 
-    if (mState.mRegisters.at(vxReg) != kkValue)
+    if (mState.mRegisters[vxReg] != kkValue)
     {
-        mState.mProgramCounter += INSTRUCTION_SIZE;
+        SkipNextInstruction();
     }
 
     return ExecutionStatus::Executed;
@@ -245,14 +327,15 @@ ExecutionStatus CPU::Execute_4xkk_SNE_VX_KK(const Instruction& instruction)
 
 // Skip next instruction if Vx = Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_5xy0_SE_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_5xy0_SE_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
     
     if (mState.mRegisters[vxReg] == mState.mRegisters[vyReg])
     {
-        mState.mProgramCounter += INSTRUCTION_SIZE;
+        SkipNextInstruction();
     }
 
     return ExecutionStatus::Executed;
@@ -260,7 +343,8 @@ ExecutionStatus CPU::Execute_5xy0_SE_VX_VY(const Instruction& instruction)
 
 // Set Vx = kk.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_6xkk_LD_VX_KK(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_6xkk_LD_VX_KK(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const uint8_t kkValue = instruction.GetOperandKK();
@@ -272,7 +356,8 @@ ExecutionStatus CPU::Execute_6xkk_LD_VX_KK(const Instruction& instruction)
 
 // Set Vx = Vx + kk.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_7xkk_ADD_VX_KK(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_7xkk_ADD_VX_KK(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const uint8_t kkValue = instruction.GetOperandKK();
@@ -284,7 +369,8 @@ ExecutionStatus CPU::Execute_7xkk_ADD_VX_KK(const Instruction& instruction)
 
 // Set Vx = Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy0_LD_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy0_LD_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
@@ -296,43 +382,65 @@ ExecutionStatus CPU::Execute_8xy0_LD_VX_VY(const Instruction& instruction)
 
 // Set Vx = Vx OR Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy1_OR_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy1_OR_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();    
 
     mState.mRegisters[vxReg] = mState.mRegisters[vxReg] | mState.mRegisters[vyReg];
 
+    if constexpr (Quirks::kLogicResetsFlag)
+    {
+        mState.mRegisters[FLAG_REGISTER_INDEX] = 0;
+    }
+
     return ExecutionStatus::Executed;
 }
 
 // Set Vx = Vx AND Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy2_AND_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy2_AND_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
 
     mState.mRegisters[vxReg] = mState.mRegisters[vxReg] & mState.mRegisters[vyReg];
 
+    if constexpr (Quirks::kLogicResetsFlag)
+    {
+        mState.mRegisters[FLAG_REGISTER_INDEX] = 0;
+    }
+
     return ExecutionStatus::Executed;
 }
 
 // Set Vx = Vx XOR Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy3_XOR_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy3_XOR_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
 
     mState.mRegisters[vxReg] = mState.mRegisters[vxReg] ^ mState.mRegisters[vyReg];
 
+    if constexpr (Quirks::kLogicResetsFlag)
+    {
+        mState.mRegisters[FLAG_REGISTER_INDEX] = 0;
+    }
+
     return ExecutionStatus::Executed;
 }
 
 // Set Vx = Vx + Vy, set VF = carry.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy4_ADD_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy4_ADD_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
@@ -348,7 +456,8 @@ ExecutionStatus CPU::Execute_8xy4_ADD_VX_VY(const Instruction& instruction)
 
 // Set Vx = Vx - Vy, set VF = NOT borrow.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy5_SUB_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy5_SUB_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
@@ -366,18 +475,21 @@ ExecutionStatus CPU::Execute_8xy5_SUB_VX_VY(const Instruction& instruction)
 
 // Set Vx = Vx SHR 1.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy6_SHR_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy6_SHR_VX_VY(const Instruction& instruction)
 {
     /*
-        NOTE: In original CHIP-8, Vy is ignored for 8xy6.
-        Vx is both the input and output register.
+        NOTE: Vy is ignored for 8xy6 unless the profile shifts Vy (COSMAC VIP).
+        Vx is always the output register.
     */
 
     const size_t vxReg = instruction.GetOperandX();
-    const uint8_t vxValue = mState.mRegisters[vxReg];
-	const uint8_t lsb = vxValue & 0x01;
+    const size_t sourceReg = Quirks::kShiftReadsVy ? instruction.GetOperandY() : vxReg;
+    const uint8_t sourceValue = mState.mRegisters[sourceReg];
+	const uint8_t lsb = sourceValue & 0x01;
 
-    mState.mRegisters[vxReg] = vxValue >> 1;
+    mState.mRegisters[vxReg] = sourceValue >> 1;
     mState.mRegisters[FLAG_REGISTER_INDEX] = lsb;
 
     return ExecutionStatus::Executed;
@@ -385,7 +497,8 @@ ExecutionStatus CPU::Execute_8xy6_SHR_VX_VY(const Instruction& instruction)
 
 // Set Vx = Vy - Vx, set VF = NOT borrow.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xy7_SUBN_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xy7_SUBN_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
@@ -403,18 +516,21 @@ ExecutionStatus CPU::Execute_8xy7_SUBN_VX_VY(const Instruction& instruction)
 
 // Set Vx = Vx SHL 1.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_8xyE_SHL_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_8xyE_SHL_VX_VY(const Instruction& instruction)
 {
     /*
-        NOTE: In original CHIP-8, Vy is ignored for 8xyE.
-        Vx is both the input and output register.
+        NOTE: Vy is ignored for 8xyE unless the profile shifts Vy (COSMAC VIP).
+        Vx is always the output register.
     */
 
     const size_t vxReg = instruction.GetOperandX();    
-    const uint8_t vxValue = mState.mRegisters[vxReg];
-    const uint8_t msb = (vxValue & 0x80) >> 7;
+    const size_t sourceReg = Quirks::kShiftReadsVy ? instruction.GetOperandY() : vxReg;
+    const uint8_t sourceValue = mState.mRegisters[sourceReg];
+    const uint8_t msb = (sourceValue & 0x80) >> 7;
 
-	mState.mRegisters[vxReg] = vxValue * 2;
+	mState.mRegisters[vxReg] = sourceValue * 2;
     mState.mRegisters[FLAG_REGISTER_INDEX] = msb;
 
     return ExecutionStatus::Executed;
@@ -422,14 +538,15 @@ ExecutionStatus CPU::Execute_8xyE_SHL_VX_VY(const Instruction& instruction)
 
 // Skip next instruction if Vx != Vy.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_9xy0_SNE_VX_VY(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_9xy0_SNE_VX_VY(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
 
     if (mState.mRegisters[vxReg] != mState.mRegisters[vyReg])
     {
-        mState.mProgramCounter += INSTRUCTION_SIZE;
+        SkipNextInstruction();
     }
 
     return ExecutionStatus::Executed;
@@ -437,7 +554,8 @@ ExecutionStatus CPU::Execute_9xy0_SNE_VX_VY(const Instruction& instruction)
 
 // Set I = nnn.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Annn_LD_I_ADDR(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Annn_LD_I_ADDR(const Instruction& instruction)
 {
     const uint16_t address = instruction.GetOperandNNN();
     mState.mIndexRegister = address;
@@ -447,40 +565,56 @@ ExecutionStatus CPU::Execute_Annn_LD_I_ADDR(const Instruction& instruction)
 
 // Jump to location nnn + V0.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Bnnn_JP_V0_ADDR(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Bnnn_JP_V0_ADDR(const Instruction& instruction)
 {
+    /*
+        NOTE: SUPER-CHIP reads the offset from Vx, where x is the top nibble of nnn.
+    */
+
     const uint16_t address = instruction.GetOperandNNN();
-	const uint8_t offset = mState.mRegisters[0];
+    const size_t offsetReg = Quirks::kJumpAddsVx ? instruction.GetOperandX() : 0;
+	const uint8_t offset = mState.mRegisters[offsetReg];
 
-    mState.mProgramCounter = address + offset;
+    mState.mProgramCounter = (address + offset) & Geometry::kAddressMask;
 
     return ExecutionStatus::Executed;
 }
 
 // Set Vx = random byte AND kk.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Cxkk_RND_VX_KK(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Cxkk_RND_VX_KK(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
 	const uint8_t kkValue = instruction.GetOperandKK();
 
-	mState.mRegisters[vxReg] = mRandomProvider.GetRandomByte() & kkValue;
+	mState.mRegisters[vxReg] = mRandomSource.GetRandomByte() & kkValue;
 
     return ExecutionStatus::Executed;
 }
 
 // Display n-byte sprite starting at memory location I at (Vx, Vy), set VF = collision.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Dxyn_DRW_VX_VY_N(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Dxyn_DRW_VX_VY_N(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
     const size_t vyReg = instruction.GetOperandY();
     const uint8_t height = instruction.GetOperandN();
+
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, height * mBus.mDisplay.GetSelectedPlaneCount()))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
        
     mState.mRegisters[FLAG_REGISTER_INDEX] = mBus.mDisplay.DrawSprite(
         mState.mRegisters[vxReg],
         mState.mRegisters[vyReg],
-        mState.mIndexRegister,
+        mState.mIndexRegister & Geometry::kAddressMask,
         height
     );    
 
@@ -489,14 +623,21 @@ ExecutionStatus CPU::Execute_Dxyn_DRW_VX_VY_N(const Instruction& instruction)
 
 // Skip next instruction if key with the value of Vx is pressed.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Ex9E_SKP_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Ex9E_SKP_VX(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
-	uint8_t keyId = mState.mRegisters[vxReg];
+	const uint8_t keyId = mState.mRegisters[vxReg];
+
+    if (IsInvalidNibble<Quirks>(keyId))
+    {
+        return ExecutionStatus::InvalidKey;
+    }
 	
-    if (mBus.mKeypad.IsKeyPressed(Key{ keyId }))
+    if (mBus.mKeypad.IsKeyPressed(Key{ static_cast<uint8_t>(keyId & kNibbleMask) }))
 	{
-		mState.mProgramCounter += INSTRUCTION_SIZE; // Skip next instruction
+		SkipNextInstruction();
 	}
 
     return ExecutionStatus::Executed;
@@ -504,14 +645,21 @@ ExecutionStatus CPU::Execute_Ex9E_SKP_VX(const Instruction& instruction)
 
 // Skip next instruction if key with the value of Vx is not pressed.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_ExA1_SKNP_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_ExA1_SKNP_VX(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
-    uint8_t keyId = mState.mRegisters[vxReg];
+    const uint8_t keyId = mState.mRegisters[vxReg];
+
+    if (IsInvalidNibble<Quirks>(keyId))
+    {
+        return ExecutionStatus::InvalidKey;
+    }
 
-    if (!mBus.mKeypad.IsKeyPressed(Key{ keyId }))
+    if (!mBus.mKeypad.IsKeyPressed(Key{ static_cast<uint8_t>(keyId & kNibbleMask) }))
     {
-        mState.mProgramCounter += INSTRUCTION_SIZE; // Skip next instruction
+        SkipNextInstruction();
     }
 
     return ExecutionStatus::Executed;
@@ -519,7 +667,8 @@ ExecutionStatus CPU::Execute_ExA1_SKNP_VX(const Instruction& instruction)
 
 // Set Vx = delay timer value.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx07_LD_VX_DT(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx07_LD_VX_DT(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
 
@@ -530,7 +679,8 @@ ExecutionStatus CPU::Execute_Fx07_LD_VX_DT(const Instruction& instruction)
 
 // Wait for a key release, store the value of the key in Vx.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx0A_LD_VX_K(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx0A_LD_VX_K(const Instruction& instruction)
 {
     /*
         Hint: Fx0A is the only opcode that waits for input.
@@ -556,7 +706,8 @@ ExecutionStatus CPU::Execute_Fx0A_LD_VX_K(const Instruction& instruction)
 
 // Set delay timer = Vx.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx15_LD_DT_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx15_LD_DT_VX(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
 
@@ -567,7 +718,8 @@ ExecutionStatus CPU::Execute_Fx15_LD_DT_VX(const Instruction& instruction)
 
 // Set sound timer = Vx.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx18_LD_ST_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx18_LD_ST_VX(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
 
@@ -578,7 +730,8 @@ ExecutionStatus CPU::Execute_Fx18_LD_ST_VX(const Instruction& instruction)
 
 // Set I = I + Vx.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx1E_ADD_I_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx1E_ADD_I_VX(const Instruction& instruction)
 {
     const size_t vxReg = instruction.GetOperandX();
 	
@@ -589,7 +742,9 @@ ExecutionStatus CPU::Execute_Fx1E_ADD_I_VX(const Instruction& instruction)
 
 // Set I = location of sprite for digit Vx.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx29_LD_F_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx29_LD_F_VX(const Instruction& instruction)
 {
     /*
         Hint: Fx29 sets I to the address of the font sprite for digit in Vx (0x00xF).
@@ -600,43 +755,63 @@ ExecutionStatus CPU::Execute_Fx29_LD_F_VX(const Instruction& instruction)
     const size_t vxReg = instruction.GetOperandX();
     const uint8_t value = mState.mRegisters[vxReg];
 
-    // validate value is within valid digit range (0F)
-    assert(value <= 0x0F && "Fx29 expects Vx to contain a hexadecimal digit (0x00xF)");
+    // Checked mode faults on anything but a hexadecimal digit; unchecked mode
+    // uses the low nibble, as the font only has sixteen sprites
+    if (IsInvalidNibble<Quirks>(value))
+    {
+        return ExecutionStatus::InvalidDigit;
+    }
 
-	mState.mIndexRegister = value * kFontSpriteSize;
+	mState.mIndexRegister = static_cast<uint16_t>((value & kNibbleMask) * kFontSpriteSize);
 
     return ExecutionStatus::Executed;
 }
 
 // Store BCD representation of Vx in memory locations I, I+1, and I+2.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx33_LD_B_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx33_LD_B_VX(const Instruction& instruction)
 {    
     const size_t vxReg = instruction.GetOperandX();
 	const uint8_t value = mState.mRegisters[vxReg];
 	const uint16_t address = mState.mIndexRegister;
 
-    const uint8_t hundreds = value / 100;
-    const uint8_t tens = (value / 10) % 10;
-    const uint8_t units = value % 10;
+    if (IsOutOfBounds<Quirks>(address, 3))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
 
-    mBus.mRAM.Write(address + 0, hundreds);
-    mBus.mRAM.Write(address + 1, tens);
-    mBus.mRAM.Write(address + 2, units);
+    const std::array<uint8_t, 3> digits = {
+        static_cast<uint8_t>(value / 100),       // Hundreds
+        static_cast<uint8_t>((value / 10) % 10), // Tens
+        static_cast<uint8_t>(value % 10)         // Units
+    };
+
+    mBus.mRAM.WriteWrapped(address, digits);
 
     return ExecutionStatus::Executed;
 }
 
 // Store registers V0 through Vx in memory starting at location I.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx55_LD_I_VX(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx55_LD_I_VX(const Instruction& instruction)
 {
     const size_t lastRegisterIndex = instruction.GetOperandX();
 
-    for (size_t vxReg = 0; vxReg <= lastRegisterIndex; ++vxReg)
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, static_cast<uint32_t>(lastRegisterIndex + 1)))
     {
-        const uint16_t address = mState.mIndexRegister + static_cast<uint16_t>(vxReg);
-        mBus.mRAM.Write(address, mState.mRegisters[vxReg]);
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    const std::span<const uint8_t> registers(mState.mRegisters.data(), lastRegisterIndex + 1);
+    mBus.mRAM.WriteWrapped(mState.mIndexRegister, registers);
+
+    if constexpr (Quirks::kLoadStoreAdvancesIndex)
+    {
+        mState.mIndexRegister += static_cast<uint16_t>(lastRegisterIndex + 1);
     }
 
     return ExecutionStatus::Executed;
@@ -644,15 +819,322 @@ ExecutionStatus CPU::Execute_Fx55_LD_I_VX(const Instruction& instruction)
 
 // Read registers V0 through Vx from memory starting at location I.
 //--------------------------------------------------------------------------------
-ExecutionStatus CPU::Execute_Fx65_LD_VX_I(const Instruction& instruction)
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx65_LD_VX_I(const Instruction& instruction)
 {
     const size_t lastRegisterIndex = instruction.GetOperandX();
 
-    for (size_t vxReg = 0; vxReg <= lastRegisterIndex; ++vxReg)
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, static_cast<uint32_t>(lastRegisterIndex + 1)))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    const std::span<uint8_t> registers(mState.mRegisters.data(), lastRegisterIndex + 1);
+    mBus.mRAM.ReadWrapped(mState.mIndexRegister, registers);
+
+    if constexpr (Quirks::kLoadStoreAdvancesIndex)
     {
-        const uint16_t address = mState.mIndexRegister + static_cast<uint16_t>(vxReg);
-        mState.mRegisters[vxReg] = mBus.mRAM.Read(address);
+        mState.mIndexRegister += static_cast<uint16_t>(lastRegisterIndex + 1);
     }
 
     return ExecutionStatus::Executed;
-}
\ No newline at end of file
+}
+
+// Scroll the display down n pixels (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00Cn_SCD_N(const Instruction& instruction)
+{
+    mBus.mDisplay.ScrollDown(instruction.GetOperandN());
+
+    return ExecutionStatus::Executed;
+}
+
+// Scroll the display right 4 pixels (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00FB_SCR(const Instruction&)
+{
+    mBus.mDisplay.ScrollRight(4);
+
+    return ExecutionStatus::Executed;
+}
+
+// Scroll the display left 4 pixels (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00FC_SCL(const Instruction&)
+{
+    mBus.mDisplay.ScrollLeft(4);
+
+    return ExecutionStatus::Executed;
+}
+
+// Exit the interpreter (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00FD_EXIT(const Instruction&)
+{
+    /*
+        NOTE: Reported as a status so every engine halts on it; PC stays on the
+        instruction, so running again exits again.
+    */
+
+    return ExecutionStatus::ProgramExited;
+}
+
+// Switch to the 64x32 display mode (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00FE_LOW(const Instruction&)
+{
+    mBus.mDisplay.SetHires(false);
+
+    return ExecutionStatus::Executed;
+}
+
+// Switch to the 128x64 display mode (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00FF_HIGH(const Instruction&)
+{
+    /*
+        NOTE: Only machines with a display larger than 64x32 have the mode (see
+        BasicDisplay); the CHIP-8 machine reports the instruction instead.
+    */
+
+    if constexpr (!BasicDisplay<Geometry>::kHasHires)
+    {
+        return ExecutionStatus::NotImplemented;
+    }
+    else
+    {
+        mBus.mDisplay.SetHires(true);
+        return ExecutionStatus::Executed;
+    }
+}
+
+// Display a 16x16 sprite from I at (Vx, Vy), set VF = collision (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Dxy0_DRW16_VX_VY(const Instruction& instruction)
+{
+    const size_t vxReg = instruction.GetOperandX();
+    const size_t vyReg = instruction.GetOperandY();
+
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, BasicDisplay<Geometry>::kLargeSpriteBytes * mBus.mDisplay.GetSelectedPlaneCount()))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    mState.mRegisters[FLAG_REGISTER_INDEX] = mBus.mDisplay.DrawLargeSprite(
+        mState.mRegisters[vxReg],
+        mState.mRegisters[vyReg],
+        mState.mIndexRegister & Geometry::kAddressMask
+    );
+
+    return ExecutionStatus::Executed;
+}
+
+// Set I = location of the large sprite for digit Vx (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx30_LD_HF_VX(const Instruction& instruction)
+{
+    const size_t vxReg = instruction.GetOperandX();
+    const uint8_t value = mState.mRegisters[vxReg];
+
+    // The large font has all sixteen digits (SUPER-CHIP's 0-9 and XO-CHIP's A-F),
+    // so the same range applies as for Fx29
+    if (IsInvalidNibble<Quirks>(value))
+    {
+        return ExecutionStatus::InvalidDigit;
+    }
+
+    mState.mIndexRegister = static_cast<uint16_t>(BIG_CHAR_SET_ADDRESS + (value & kNibbleMask) * kBigFontSpriteSize);
+
+    return ExecutionStatus::Executed;
+}
+
+// Store V0 through Vx in the persistent user flags (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx75_LD_R_VX(const Instruction& instruction)
+{
+    const size_t lastRegisterIndex = instruction.GetOperandX();
+    std::copy_n(mState.mRegisters.begin(), lastRegisterIndex + 1, mState.mUserFlags.begin());
+
+    return ExecutionStatus::Executed;
+}
+
+// Read V0 through Vx from the persistent user flags (SUPER-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx85_LD_VX_R(const Instruction& instruction)
+{
+    const size_t lastRegisterIndex = instruction.GetOperandX();
+    std::copy_n(mState.mUserFlags.begin(), lastRegisterIndex + 1, mState.mRegisters.begin());
+
+    return ExecutionStatus::Executed;
+}
+
+// Scroll the display up n pixels (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_00Dn_SCU_N(const Instruction& instruction)
+{
+    mBus.mDisplay.ScrollUp(instruction.GetOperandN());
+
+    return ExecutionStatus::Executed;
+}
+
+// Store Vx through Vy in memory starting at I, leaving I unchanged (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_5xy2_LD_I_VX_VY(const Instruction& instruction)
+{
+    /*
+        The range runs from Vx to Vy in either direction, so 5312 stores V3
+        then V2 and V1.
+    */
+
+    const size_t vxReg = instruction.GetOperandX();
+    const size_t vyReg = instruction.GetOperandY();
+    const size_t count = (vxReg <= vyReg ? vyReg - vxReg : vxReg - vyReg) + 1;
+
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, static_cast<uint32_t>(count)))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    std::array<uint8_t, REGISTER_COUNT> values;
+    if (vxReg <= vyReg)
+    {
+        std::copy_n(mState.mRegisters.begin() + vxReg, count, values.begin());
+    }
+    else
+    {
+        std::reverse_copy(mState.mRegisters.begin() + vyReg, mState.mRegisters.begin() + vxReg + 1, values.begin());
+    }
+
+    mBus.mRAM.WriteWrapped(mState.mIndexRegister, std::span<const uint8_t>(values.data(), count));
+
+    return ExecutionStatus::Executed;
+}
+
+// Read Vx through Vy from memory starting at I, leaving I unchanged (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_5xy3_LD_VX_VY_I(const Instruction& instruction)
+{
+    const size_t vxReg = instruction.GetOperandX();
+    const size_t vyReg = instruction.GetOperandY();
+    const size_t count = (vxReg <= vyReg ? vyReg - vxReg : vxReg - vyReg) + 1;
+
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, static_cast<uint32_t>(count)))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    std::array<uint8_t, REGISTER_COUNT> values;
+    mBus.mRAM.ReadWrapped(mState.mIndexRegister, std::span<uint8_t>(values.data(), count));
+
+    if (vxReg <= vyReg)
+    {
+        std::copy_n(values.begin(), count, mState.mRegisters.begin() + vxReg);
+    }
+    else
+    {
+        std::reverse_copy(values.begin(), values.begin() + count, mState.mRegisters.begin() + vyReg);
+    }
+
+    return ExecutionStatus::Executed;
+}
+
+// Set I = nnnn, the word that follows the instruction (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_F000_LD_I_LONG(const Instruction&)
+{
+    /*
+        NOTE: The only four-byte instruction. PC already points at nnnn, so the
+        handler reads it and steps PC past it; the instruction ends a block (see
+        ControlFlow::kLongLoad), so engines continue from that PC.
+    */
+
+    const uint16_t operandAddress = mState.mProgramCounter;
+
+    if (IsOutOfBounds<Quirks>(operandAddress, INSTRUCTION_SIZE))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    std::array<uint8_t, INSTRUCTION_SIZE> operand;
+    mBus.mRAM.ReadWrapped(operandAddress, operand);
+
+    mState.mIndexRegister = static_cast<uint16_t>((operand[0] << 8) | operand[1]);
+    mState.mProgramCounter = static_cast<uint16_t>(operandAddress + INSTRUCTION_SIZE);
+
+    return ExecutionStatus::Executed;
+}
+
+// Select the bit planes n that drawing, clearing and scrolling apply to (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fn01_PLANE_N(const Instruction& instruction)
+{
+    mBus.mDisplay.SelectPlanes(static_cast<uint8_t>(instruction.GetOperandX()));
+
+    return ExecutionStatus::Executed;
+}
+
+// Load the 16-byte audio pattern from memory starting at I (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_F002_AUDIO(const Instruction&)
+{
+    if (IsOutOfBounds<Quirks>(mState.mIndexRegister, SoundTimer::kPatternBytes))
+    {
+        return ExecutionStatus::InvalidAddressOutOfBounds;
+    }
+
+    SoundTimer::Pattern pattern;
+    mBus.mRAM.ReadWrapped(mState.mIndexRegister, pattern);
+    mBus.mSoundTimer.LoadPattern(pattern);
+
+    return ExecutionStatus::Executed;
+}
+
+// Set the audio pitch = Vx (XO-CHIP).
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_Fx3A_LD_PITCH_VX(const Instruction& instruction)
+{
+    const size_t vxReg = instruction.GetOperandX();
+
+    mBus.mSoundTimer.SetPitch(mState.mRegisters[vxReg]);
+
+    return ExecutionStatus::Executed;
+}
+
+// Explicit instantiations - one CPU per machine and, on each, one quirk handler
+// set per policy. The dispatch switches need none: BindPolicy takes the address
+// of every Execute<Quirks>.
+//--------------------------------------------------------------------------------
+#define IGNORE_HANDLER(pattern, mnemonic, ...)
+#define INSTANTIATE_QUIRK_HANDLER(pattern, mnemonic, Quirks, Geometry, TRandom) \
+    template ExecutionStatus BasicCPU<Geometry, TRandom>::Execute_##pattern##_##mnemonic<Quirks>(const Instruction&);
+#define INSTANTIATE_QUIRK_HANDLERS(Quirks, Geometry, TRandom) \
+    OPCODE_HANDLER_LIST(IGNORE_HANDLER, INSTANTIATE_QUIRK_HANDLER, Quirks, Geometry, TRandom)
+#define INSTANTIATE_CPU(Geometry, TRandom) \
+    template class BasicCPU<Geometry, TRandom>; \
+    QUIRK_POLICY_LIST(INSTANTIATE_QUIRK_HANDLERS, Geometry, TRandom)
+
+MACHINE_LIST(INSTANTIATE_CPU)
\ No newline at end of file
@@ -3,80 +3,241 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Interpreter
-#include "Interfaces/IRandomProvider.h"
 #include "Constants.h"
+#include "Interfaces/IRandomProvider.h"
 #include "Types/FetchResult.h"
 #include "Interpreter/Hardware/CPUState.h"
+#include "Interpreter/Hardware/Quirks.h"
+#include "Interpreter/Hardware/RandomProvider.h"
 #include "Types/ExecutionStatus.h"
 #include "Interpreter/Bus.h"  // TODO: forward declare
+#include "Interpreter/Instruction/DecodeTable.h"
 #include "Interpreter/Instruction/Instruction.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
+#include "Types/ExecutionMode.h"
+#include "Types/InstructionSet.h"
+#include "Types/QuirkProfile.h"
 
 // Macros
 //--------------------------------------------------------------------------------
 #define DECLARE_OPCODE_HANDLER(pattern, mnemonic) ExecutionStatus Execute_##pattern##_##mnemonic(const Instruction& instruction);
+#define DECLARE_QUIRK_OPCODE_HANDLER(pattern, mnemonic) template <QuirkPolicy Quirks> DECLARE_OPCODE_HANDLER(pattern, mnemonic)
+
+// Every opcode handler in OpcodeId order, as X(pattern, mnemonic) or, for handlers
+// templated on a QuirkPolicy, Q(pattern, mnemonic). Further arguments are passed on
+// after the mnemonic.
+#define OPCODE_HANDLER_LIST(X, Q, ...) \
+	X(0nnn, SYS_ADDR __VA_OPT__(,) __VA_ARGS__) \
+	X(00E0, CLS __VA_OPT__(,) __VA_ARGS__) \
+	Q(00EE, RET __VA_OPT__(,) __VA_ARGS__) \
+	X(1nnn, JP_ADDR __VA_OPT__(,) __VA_ARGS__) \
+	Q(2nnn, CALL_ADDR __VA_OPT__(,) __VA_ARGS__) \
+	X(3xkk, SE_VX_KK __VA_OPT__(,) __VA_ARGS__) \
+	X(4xkk, SNE_VX_KK __VA_OPT__(,) __VA_ARGS__) \
+	X(5xy0, SE_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(6xkk, LD_VX_KK __VA_OPT__(,) __VA_ARGS__) \
+	X(7xkk, ADD_VX_KK __VA_OPT__(,) __VA_ARGS__) \
+	X(8xy0, LD_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(8xy1, OR_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(8xy2, AND_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(8xy3, XOR_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(8xy4, ADD_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(8xy5, SUB_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(8xy6, SHR_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(8xy7, SUBN_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(8xyE, SHL_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(9xy0, SNE_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	X(Annn, LD_I_ADDR __VA_OPT__(,) __VA_ARGS__) \
+	Q(Bnnn, JP_V0_ADDR __VA_OPT__(,) __VA_ARGS__) \
+	Q(Cxkk, RND_VX_KK __VA_OPT__(,) __VA_ARGS__) \
+	Q(Dxyn, DRW_VX_VY_N __VA_OPT__(,) __VA_ARGS__) \
+	Q(Ex9E, SKP_VX __VA_OPT__(,) __VA_ARGS__) \
+	Q(ExA1, SKNP_VX __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx07, LD_VX_DT __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx0A, LD_VX_K __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx15, LD_DT_VX __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx18, LD_ST_VX __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx1E, ADD_I_VX __VA_OPT__(,) __VA_ARGS__) \
+	Q(Fx29, LD_F_VX __VA_OPT__(,) __VA_ARGS__) \
+	Q(Fx33, LD_B_VX __VA_OPT__(,) __VA_ARGS__) \
+	Q(Fx55, LD_I_VX __VA_OPT__(,) __VA_ARGS__) \
+	Q(Fx65, LD_VX_I __VA_OPT__(,) __VA_ARGS__) \
+	X(00Cn, SCD_N __VA_OPT__(,) __VA_ARGS__) \
+	X(00FB, SCR __VA_OPT__(,) __VA_ARGS__) \
+	X(00FC, SCL __VA_OPT__(,) __VA_ARGS__) \
+	X(00FD, EXIT __VA_OPT__(,) __VA_ARGS__) \
+	X(00FE, LOW __VA_OPT__(,) __VA_ARGS__) \
+	X(00FF, HIGH __VA_OPT__(,) __VA_ARGS__) \
+	Q(Dxy0, DRW16_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(Fx30, LD_HF_VX __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx75, LD_R_VX __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx85, LD_VX_R __VA_OPT__(,) __VA_ARGS__) \
+	X(00Dn, SCU_N __VA_OPT__(,) __VA_ARGS__) \
+	Q(5xy2, LD_I_VX_VY __VA_OPT__(,) __VA_ARGS__) \
+	Q(5xy3, LD_VX_VY_I __VA_OPT__(,) __VA_ARGS__) \
+	Q(F000, LD_I_LONG __VA_OPT__(,) __VA_ARGS__) \
+	X(Fn01, PLANE_N __VA_OPT__(,) __VA_ARGS__) \
+	Q(F002, AUDIO __VA_OPT__(,) __VA_ARGS__) \
+	X(Fx3A, LD_PITCH_VX __VA_OPT__(,) __VA_ARGS__)
+
+// Every machine the CPU is built for, as X(Geometry, TRandom): each configuration
+// (see MachineGeometry) with each random source Cxkk calls. TRandom is
+// IRandomProvider through its virtual call (tests and mocks), or the final
+// RandomProvider, which is called directly.
+#define MACHINE_LIST(X) \
+	X(Chip8Geometry, IRandomProvider) \
+	X(SuperChipGeometry, IRandomProvider) \
+	X(XoChipGeometry, IRandomProvider) \
+	X(Chip8Geometry, RandomProvider) \
+	X(SuperChipGeometry, RandomProvider) \
+	X(XoChipGeometry, RandomProvider)
 
 // TODO: think organisation of methods
 //--------------------------------------------------------------------------------
-class CPU
+template <typename Geometry, RandomSource TRandom>
+class BasicCPU
 {
 #ifdef UNIT_TESTING
 	friend class OpcodeTest;
 #endif
+	friend class AotRuntime;
+	template <typename TCPU> friend class BasicBlockCache;
+	friend class BlockEngine;
+	template <typename TCPU> friend class BasicClosureCache;
+	friend class Superinstructions;
+	friend class ThreadedEngine;
 
 public:
-	CPU(Bus& bus, IRandomProvider& randomProvider);
+	// The configuration the CPU is built for; its bus and state share it
+	using GeometryType = Geometry;
+	using BusType = BasicBus<Geometry>;
+	using StateType = BasicCPUState<Geometry::kStackSize>;
+	using RandomSourceType = TRandom;
+
+	BasicCPU(BusType& bus, TRandom& randomSource);
 
 	void Reset();
 	void DecrementTimers();
 	
+	// Peek and Fetch validate PC in full and report why it cannot be fetched from
 	[[nodiscard]] FetchResult Peek() const;
 	[[nodiscard]] FetchResult Fetch();
 	[[nodiscard]] Instruction Decode(uint16_t opcode) const;
+
+	// Runs the instruction with the handlers of the current quirk profile.
+	[[nodiscard]] ExecutionStatus Execute(const Instruction& instruction) { return (this->*mExecute)(instruction); }
+
+	// Runs the instruction with the handlers of a fixed quirk policy.
+	template <QuirkPolicy Quirks>
 	[[nodiscard]] ExecutionStatus Execute(const Instruction& instruction);
 
-	const CPUState& GetState() const { return mState; }	
+	void SetQuirkProfile(QuirkProfile profile);
+	QuirkProfile GetQuirkProfile() const { return mQuirkProfile; }
+	void SetExecutionMode(ExecutionMode mode);
+	ExecutionMode GetExecutionMode() const { return mExecutionMode; }
+
+	// Binds the decode table of an instruction set. Handlers cover every set, so
+	// this is the only thing that changes.
+	void SetInstructionSet(InstructionSet instructionSet);
+	InstructionSet GetInstructionSet() const { return mInstructionSet; }
+
+	// True if the instruction set has the four-byte F000 nnnn, so a taken skip
+	// must look at what it skips (see SkipNextInstruction).
+	bool HasLongInstructions() const { return mHasLongInstructions; }
+
+	// Steps PC, which points at the instruction after a skip, past that
+	// instruction: two bytes, or four for an F000 nnnn the decode table knows.
+	void SkipNextInstruction()
+	{
+		uint16_t length = INSTRUCTION_SIZE;
+		if (mHasLongInstructions)
+		{
+			const uint16_t address = mState.mProgramCounter;
+			const uint16_t opcode = static_cast<uint16_t>((mBus.mRAM.Read(address & Geometry::kAddressMask) << 8)
+				| mBus.mRAM.Read((address + 1) & Geometry::kAddressMask));
+			length = GetInstructionLength((*mDecodeTable)[opcode]);
+		}
+		mState.mProgramCounter += length;
+	}
+
+	// True if an instruction can be fetched from address: aligned and within the
+	// program region. Stepping +2 from a fetchable address can only leave it by
+	// running off the end of RAM.
+	static constexpr bool IsFetchable(uint16_t address)
+	{
+		return address % INSTRUCTION_SIZE == 0 && address >= PROGRAM_START_ADDRESS && address < Geometry::kRamSize - 1;
+	}
+
+	// The sequential fetch address after a fetch from address, for engines that
+	// only validate PC after control flow. On a 64 KB machine the step past the
+	// last instruction wraps to 0, which is not fetchable, so address stands in.
+	static constexpr uint16_t GetSequentialAddress(uint16_t address)
+	{
+		if constexpr (Geometry::kRamSize > UINT16_MAX)
+		{
+			if (address > UINT16_MAX - INSTRUCTION_SIZE)
+			{
+				return address;
+			}
+		}
+		return static_cast<uint16_t>(address + INSTRUCTION_SIZE);
+	}
+
+	const StateType& GetState() const { return mState; }	
 	uint16_t GetProgramCounter() const { return mState.mProgramCounter; }
 	void SetProgramCounter(uint16_t address) { mState.mProgramCounter = address; }
 
 private:
 	// One method per opcode
-	DECLARE_OPCODE_HANDLER(0nnn, SYS_ADDR)
-	DECLARE_OPCODE_HANDLER(00E0, CLS)
-	DECLARE_OPCODE_HANDLER(00EE, RET)
-	DECLARE_OPCODE_HANDLER(1nnn, JP_ADDR)
-	DECLARE_OPCODE_HANDLER(2nnn, CALL_ADDR)
-	DECLARE_OPCODE_HANDLER(3xkk, SE_VX_KK)
-	DECLARE_OPCODE_HANDLER(4xkk, SNE_VX_KK)
-	DECLARE_OPCODE_HANDLER(5xy0, SE_VX_VY)
-	DECLARE_OPCODE_HANDLER(6xkk, LD_VX_KK)
-	DECLARE_OPCODE_HANDLER(7xkk, ADD_VX_KK)
-	DECLARE_OPCODE_HANDLER(8xy0, LD_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy1, OR_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy2, AND_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy3, XOR_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy4, ADD_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy5, SUB_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy6, SHR_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xy7, SUBN_VX_VY)
-	DECLARE_OPCODE_HANDLER(8xyE, SHL_VX_VY)
-	DECLARE_OPCODE_HANDLER(9xy0, SNE_VX_VY)
-	DECLARE_OPCODE_HANDLER(Annn, LD_I_ADDR)
-	DECLARE_OPCODE_HANDLER(Bnnn, JP_V0_ADDR)
-	DECLARE_OPCODE_HANDLER(Cxkk, RND_VX_KK)
-	DECLARE_OPCODE_HANDLER(Dxyn, DRW_VX_VY_N)
-	DECLARE_OPCODE_HANDLER(Ex9E, SKP_VX)
-	DECLARE_OPCODE_HANDLER(ExA1, SKNP_VX)
-	DECLARE_OPCODE_HANDLER(Fx07, LD_VX_DT)
-	DECLARE_OPCODE_HANDLER(Fx0A, LD_VX_K)
-	DECLARE_OPCODE_HANDLER(Fx15, LD_DT_VX)
-	DECLARE_OPCODE_HANDLER(Fx18, LD_ST_VX)
-	DECLARE_OPCODE_HANDLER(Fx1E, ADD_I_VX)
-	DECLARE_OPCODE_HANDLER(Fx29, LD_F_VX)
-	DECLARE_OPCODE_HANDLER(Fx33, LD_B_VX)
-	DECLARE_OPCODE_HANDLER(Fx55, LD_I_VX)
-	DECLARE_OPCODE_HANDLER(Fx65, LD_VX_I)
-
-	Bus& mBus;
-	IRandomProvider& mRandomProvider;
-	CPUState mState;
-};
\ No newline at end of file
+	OPCODE_HANDLER_LIST(DECLARE_OPCODE_HANDLER, DECLARE_QUIRK_OPCODE_HANDLER)
+
+	// Selects the Execute instantiation for the current profile and mode
+	void BindPolicy();
+
+	// Faults if count bytes from address would run past the end of RAM
+	template <QuirkPolicy Quirks>
+	static bool IsOutOfBounds(uint32_t address, uint32_t count)
+	{
+		if constexpr (Quirks::kIsChecked)
+		{
+			return address + count > Geometry::kRamSize;
+		}
+		return false;
+	}
+
+	// Faults on a key or font digit above 0xF (Ex9E, ExA1, Fx29, Fx30). Unchecked mode
+	// masks the value to its low nibble instead.
+	template <QuirkPolicy Quirks>
+	static bool IsInvalidNibble(uint8_t value)
+	{
+		if constexpr (Quirks::kIsChecked)
+		{
+			return value > kNibbleMask;
+		}
+		return false;
+	}
+
+	static constexpr uint8_t kNibbleMask = 0x0F;
+
+	using ExecuteFunction = ExecutionStatus (BasicCPU::*)(const Instruction&);
+
+	// Hot: the state's first line, then the pointers every instruction follows
+	alignas(kCacheLineSize) StateType mState;
+	BusType& mBus;
+	const DecodeTable::Table* mDecodeTable = &DecodeTable::Get(InstructionSet::kChip8);
+	ExecuteFunction mExecute = &BasicCPU::Execute<ModernQuirks>;
+	bool mHasLongInstructions = false; // Read by every taken skip
+
+	// Cold: only read when the configuration changes, or by Cxkk
+	TRandom& mRandomSource;
+	QuirkProfile mQuirkProfile = QuirkProfile::kModern;
+	ExecutionMode mExecutionMode = ExecutionMode::kUnchecked;
+	InstructionSet mInstructionSet = InstructionSet::kChip8;
+};
+
+// One CPU per configuration, for any IRandomProvider called through its vtable.
+// CPU is the CHIP-8 one most code runs.
+using Chip8CPU = BasicCPU<Chip8Geometry, IRandomProvider>;
+using SuperChipCPU = BasicCPU<SuperChipGeometry, IRandomProvider>;
+using XoChipCPU = BasicCPU<XoChipGeometry, IRandomProvider>;
+using CPU = Chip8CPU;
\ No newline at end of file
@@ -4,24 +4,42 @@
 //--------------------------------------------------------------------------------
 // Interpreter
 #include "Constants.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
 
 // System
 #include <array>
+#include <cstddef>
 
+// Ordered by use: everything an instruction can touch comes first and fits in
+// one cache line, so a machine's per-instruction state is a single line however
+// many machines share the core. Cold state follows it.
+//
+// Only the stack depth shapes the state, so configurations of the same depth
+// share one state type (see MachineGeometry::kStackSize).
 //--------------------------------------------------------------------------------
-struct CPUState
+template <uint32_t StackSize>
+struct BasicCPUState
 {
 	// Core CPU State
 	std::array<uint8_t, REGISTER_COUNT> mRegisters{ }; // V0-VF
-	uint16_t mIndexRegister = 0;  // I
 	uint16_t mProgramCounter = 0; // PC
-	uint16_t mCycleCount = 0;
-
-	// Stack
-	uint8_t mStackPointer = 0; // SP
-	std::array<uint16_t, STACK_SIZE> mStack{ };
+	uint16_t mIndexRegister = 0;  // I
+	uint8_t mStackPointer = 0;    // SP
 
 	// Timers
 	uint8_t mDelayTimer = 0;
 	uint8_t mSoundTimer = 0;
+
+	// Stack
+	std::array<uint16_t, StackSize> mStack{ };
+
+	// Cold: SUPER-CHIP/XO-CHIP persistent flags (Fx75/Fx85), kept across resets
+	std::array<uint8_t, REGISTER_COUNT> mUserFlags{ };
+
+	bool operator==(const BasicCPUState&) const = default;
 };
+
+#define ASSERT_HOT_CPU_STATE_FITS_CACHE_LINE(Geometry) \
+	static_assert(offsetof(BasicCPUState<Geometry::kStackSize>, mStack) + sizeof(BasicCPUState<Geometry::kStackSize>::mStack) <= kCacheLineSize, \
+		"Hot CPU state of " #Geometry " must fit in one cache line");
+MACHINE_GEOMETRY_LIST(ASSERT_HOT_CPU_STATE_FITS_CACHE_LINE)
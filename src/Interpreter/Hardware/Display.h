@@ -4,26 +4,51 @@
 //--------------------------------------------------------------------------------
 // Interpreter
 #include "Constants.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
 #include "Interpreter/Hardware/RAM.h"
+#include "Types/DisplayView.h"
 
 // System
 #include <array>
+#include <bit>
 #include <cassert>
 #include <algorithm>
+#include <span>
 
+// Framebuffer of Geometry::kDisplayWidth x kDisplayHeight pixels. Each pixel is
+// a byte with one bit per plane: XO-CHIP selects which planes draw, clear and
+// scroll (Fn01); everything else only uses the first.
+//
+// A display larger than CHIP-8's 64x32 has the two SUPER-CHIP modes: hires
+// works at the full resolution and lores at 64x32, each pixel covering a
+// kLoresScale square. Scroll distances are in pixels of the current mode. The
+// CHIP-8 display is lores only, at a scale of 1.
 //--------------------------------------------------------------------------------
-class Display
+template <typename Geometry>
+class BasicDisplay
 {
 #ifdef UNIT_TESTING
     friend class DisplayTestAccessor;
 #endif
 
 public:
-    Display()
+    static constexpr uint32_t kMaxSpriteHeight = 15; // Dxyn's N is a nibble
+    static constexpr uint32_t kLargeSpriteBytes = 32; // Dxy0: 16 rows of 16 pixels
+    static constexpr uint32_t kWidth = Geometry::kDisplayWidth;
+    static constexpr uint32_t kHeight = Geometry::kDisplayHeight;
+    static constexpr uint32_t kLoresScale = kWidth / DISPLAY_WIDTH;
+    static constexpr bool kHasHires = kLoresScale > 1;
+    static constexpr uint8_t kFirstPlane = 0b01;
+    static constexpr uint8_t kAllPlanes = 0b11;
+
+    static_assert(kWidth == DISPLAY_WIDTH * kLoresScale && kHeight == DISPLAY_HEIGHT * kLoresScale,
+        "The display must scale 64x32 by a whole number");
+
+    BasicDisplay()
         : mBuffer{ }
     { }
 
-    void SetRAM(RAM& ram) { mRAM = &ram; }
+    void SetRAM(BasicRAM<Geometry>& ram) { mRAM = &ram; }
 
     [[nodiscard]] uint8_t DrawSprite(uint32_t px, uint32_t py, uint16_t spriteAddress, uint32_t height)
     {
@@ -33,68 +58,290 @@ public:
             Drawing is clipped at screen boundaries. Only the 'starting' X and Y wrap around.
         */
 
+        assert(height <= kMaxSpriteHeight);
+
+        return DrawPlanes<1>(px, py, spriteAddress, height);
+    }
+
+    // SUPER-CHIP Dxy0: a 16x16 sprite of two bytes per row, otherwise as DrawSprite.
+    [[nodiscard]] uint8_t DrawLargeSprite(uint32_t px, uint32_t py, uint16_t spriteAddress)
+    {
+        return DrawPlanes<2>(px, py, spriteAddress, kLargeSpriteBytes);
+    }
+
+    // SUPER-CHIP/XO-CHIP scrolling of the selected planes. Pixels scrolled off the
+    // edge are lost and the vacated rows or columns are cleared.
+    void ScrollDown(uint32_t rows)
+    {
+        const size_t shift = std::min<size_t>(rows * GetScale(), kHeight) * kWidth;
+        for (size_t index = mBuffer.size(); index-- > shift; )
+        {
+            MovePixel(index, index - shift);
+        }
+        ClearPixels(0, shift);
+        ++mRevision;
+    }
+
+    void ScrollUp(uint32_t rows)
+    {
+        const size_t shift = std::min<size_t>(rows * GetScale(), kHeight) * kWidth;
+        for (size_t index = 0; index + shift < mBuffer.size(); ++index)
+        {
+            MovePixel(index, index + shift);
+        }
+        ClearPixels(mBuffer.size() - shift, mBuffer.size());
+        ++mRevision;
+    }
+
+    void ScrollRight(uint32_t columns)
+    {
+        const size_t shift = std::min<size_t>(columns * GetScale(), kWidth);
+        for (size_t row = 0; row < mBuffer.size(); row += kWidth)
+        {
+            for (size_t x = kWidth; x-- > shift; )
+            {
+                MovePixel(row + x, row + x - shift);
+            }
+            ClearPixels(row, row + shift);
+        }
+        ++mRevision;
+    }
+
+    void ScrollLeft(uint32_t columns)
+    {
+        const size_t shift = std::min<size_t>(columns * GetScale(), kWidth);
+        for (size_t row = 0; row < mBuffer.size(); row += kWidth)
+        {
+            for (size_t x = 0; x + shift < kWidth; ++x)
+            {
+                MovePixel(row + x, row + x + shift);
+            }
+            ClearPixels(row + kWidth - shift, row + kWidth);
+        }
+        ++mRevision;
+    }
+
+    // Clears the selected planes
+    void Clear()
+    {
+        ClearPixels(0, mBuffer.size());
+        ++mRevision;
+    }
+
+    // Power-on state: lores, first plane selected, screen clear
+    void Reset()
+    {
+        mIsHires = false;
+        mPlaneMask = kFirstPlane;
+        std::fill(mBuffer.begin(), mBuffer.end(), 0);
+        ++mRevision;
+    }
+
+    // SUPER-CHIP 00FE/00FF. Switching mode clears every plane, as XO-CHIP
+    // interpreters do, so no pixel is left straddling two resolutions.
+    void SetHires(bool isHires)
+    {
+        assert((kHasHires || !isHires) && "The display has no hires mode");
+
+        mIsHires = kHasHires && isHires;
+        std::fill(mBuffer.begin(), mBuffer.end(), 0);
+        ++mRevision;
+    }
+
+    bool IsHires() const { return mIsHires; }
+
+    // XO-CHIP Fn01: the planes later draws, clears and scrolls apply to
+    void SelectPlanes(uint8_t planeMask) { mPlaneMask = planeMask & kAllPlanes; }
+    uint8_t GetPlaneMask() const { return mPlaneMask; }
+    uint32_t GetSelectedPlaneCount() const { return static_cast<uint32_t>(std::popcount(mPlaneMask)); }
+
+    // Incremented whenever pixels may have changed, so callers can detect redraws
+    uint64_t GetRevision() const { return mRevision; }
+
+    // True if the pixel is on in any plane. Coordinates are in full-resolution pixels.
+    bool IsPixelSet(uint32_t px, uint32_t py) const
+    {
+        return GetPixel(px, py) != 0;
+    }
+
+    // The plane bits of a pixel
+    uint8_t GetPixel(uint32_t px, uint32_t py) const
+    {
+        assert(px < kWidth && py < kHeight);
+        return mBuffer[PixelToIndex(px, py)];
+    }
+
+    DisplayView GetView() const { return { mBuffer, kWidth, kHeight }; }
+
+private:
+    using SpriteBuffer = std::array<uint8_t, kLargeSpriteBytes * 2>; // A large sprite on both planes
+
+    // Fetches the sprite's bytes as one block, copying only when they wrap past the end of RAM
+    std::span<const uint8_t> FetchRows(uint16_t spriteAddress, uint32_t length, SpriteBuffer& buffer) const
+    {
         assert(mRAM && "Bus must be set before drawing");
 
+        const std::span<const uint8_t> rows = mRAM->View(spriteAddress, length);
+        if (rows.size() == length)
+        {
+            return rows;
+        }
+
+        mRAM->ReadWrapped(spriteAddress, std::span(buffer).first(length));
+        return std::span(buffer).first(length);
+    }
+
+    // Draws planeBytes of sprite data to each selected plane in turn, the first
+    // plane taking the first block, and reports a collision on any of them.
+    template <uint32_t kBytesPerRow>
+    uint8_t DrawPlanes(uint32_t px, uint32_t py, uint16_t spriteAddress, uint32_t planeBytes)
+    {
+        SpriteBuffer buffer;
+        const std::span<const uint8_t> sprite = FetchRows(spriteAddress, planeBytes * GetSelectedPlaneCount(), buffer);
+
+        uint8_t isCollision = 0;
+        size_t offset = 0;
+        for (uint8_t plane = kFirstPlane; plane <= kAllPlanes; plane <<= 1)
+        {
+            if ((mPlaneMask & plane) == 0)
+            {
+                continue;
+            }
+
+            isCollision |= DrawRows<kBytesPerRow>(px, py, sprite.subspan(offset, planeBytes), plane);
+            offset += planeBytes;
+        }
+
+        return isCollision;
+    }
+
+    template <uint32_t kBytesPerRow>
+    uint8_t DrawRows(uint32_t px, uint32_t py, std::span<const uint8_t> sprite, uint8_t plane)
+    {
+        if constexpr (kHasHires)
+        {
+            if (!mIsHires)
+            {
+                return DrawScaledRows<kBytesPerRow, kLoresScale>(px, py, sprite, plane);
+            }
+        }
+        return DrawScaledRows<kBytesPerRow, 1>(px, py, sprite, plane);
+    }
+
+    // Draws in the coordinates of a mode kScale times coarser than the buffer
+    template <uint32_t kBytesPerRow, uint32_t kScale>
+    uint8_t DrawScaledRows(uint32_t px, uint32_t py, std::span<const uint8_t> sprite, uint8_t plane)
+    {
+        constexpr uint32_t kRowWidth = SPRITE_ROW_WIDTH * kBytesPerRow;
+        constexpr uint32_t kLeftmostPixel = 1u << (kRowWidth - 1);
+        constexpr uint32_t kModeWidth = kWidth / kScale;
+        constexpr uint32_t kModeHeight = kHeight / kScale;
+
         uint8_t isCollision = 0;
+        bool isChanged = false;
 
-        uint16_t xStart = px % DISPLAY_WIDTH;
-        uint16_t yStart = py % DISPLAY_HEIGHT;
+        const uint32_t xStart = px % kModeWidth;
+        const uint32_t yStart = py % kModeHeight;
 
-        for (uint16_t row = 0; row < height; ++row)
+        const size_t height = sprite.size() / kBytesPerRow;
+        for (uint32_t row = 0; row < height; ++row)
         {
-            uint8_t byte = mRAM->Read(spriteAddress + row);
-            for (uint8_t bit = 0; bit < SPRITE_ROW_WIDTH; ++bit)
+            const uint32_t y = yStart + row;
+            if (y >= kModeHeight)
+            {
+                break; // Rows past the bottom edge are clipped
+            }
+
+            uint32_t pixels = 0;
+            for (uint32_t byte = 0; byte < kBytesPerRow; ++byte)
+            {
+                pixels = (pixels << 8) | sprite[row * kBytesPerRow + byte];
+            }
+
+            for (uint32_t bit = 0; bit < kRowWidth; ++bit)
             {
-                bool pixelSet = (byte & (0x80 >> bit)) != 0;
-                if (!pixelSet)
+                const uint32_t x = xStart + bit;
+                if (x >= kModeWidth)
                 {
-                    continue;
+                    break; // Columns past the right edge are clipped
                 }
 
-                uint16_t x = xStart + bit;
-                uint16_t y = yStart + row;
-
-                if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+                if ((pixels & (kLeftmostPixel >> bit)) == 0)
                 {
-                    continue; // Skip out-of-bounds pixels
+                    continue;
                 }
 
-                bool wasSet = IsPixelSet(x, y);
-                if (wasSet)
+                uint8_t* const pixel = &mBuffer[PixelToIndex(x * kScale, y * kScale)];
+                if ((*pixel & plane) != 0)
                 {
                     isCollision = 1;
                 }
 
-                SetPixel(x, y, !wasSet); // XOR toggle
+                for (uint32_t dy = 0; dy < kScale; ++dy)
+                {
+                    for (uint32_t dx = 0; dx < kScale; ++dx)
+                    {
+                        pixel[dy * kWidth + dx] ^= plane; // XOR toggle
+                    }
+                }
+                isChanged = true;
             }
         }
 
+        if (isChanged)
+        {
+            ++mRevision;
+        }
+
         return isCollision;
     }
 
-    void Clear()
+    // Buffer pixels per pixel of the current mode, along each axis
+    uint32_t GetScale() const
     {
-        std::fill(mBuffer.begin(), mBuffer.end(), 0);
+        if constexpr (kHasHires)
+        {
+            return mIsHires ? 1 : kLoresScale;
+        }
+        else
+        {
+            return 1;
+        }
     }
 
-    bool IsPixelSet(uint32_t px, uint32_t py) const
+    // Copies the selected planes of one pixel to another, keeping the rest
+    void MovePixel(size_t to, size_t from)
     {
-        assert(px < DISPLAY_WIDTH && py < DISPLAY_HEIGHT);
-        return mBuffer[PixelToIndex(px, py)] != 0;
+        mBuffer[to] = static_cast<uint8_t>((mBuffer[to] & ~mPlaneMask) | (mBuffer[from] & mPlaneMask));
     }
 
-private:
+    // Clears the selected planes of the pixels in [first, last)
+    void ClearPixels(size_t first, size_t last)
+    {
+        const uint8_t keepMask = static_cast<uint8_t>(~mPlaneMask);
+        for (size_t index = first; index < last; ++index)
+        {
+            mBuffer[index] &= keepMask;
+        }
+    }
+
+    // Sets or clears a pixel on the first plane only
     void SetPixel(uint32_t px, uint32_t py, bool value)
     {
-        assert(px < DISPLAY_WIDTH && py < DISPLAY_HEIGHT);
-        mBuffer[PixelToIndex(px, py)] = value ? 1 : 0;
+        assert(px < kWidth && py < kHeight);
+        mBuffer[PixelToIndex(px, py)] = value ? kFirstPlane : 0;
     }
 
     size_t PixelToIndex(uint32_t px, uint32_t py) const
     {
-        return px + py * DISPLAY_WIDTH;
+        return px + py * kWidth;
     }
 
-    RAM* mRAM = nullptr;
-    std::array<uint32_t, DISPLAY_PIXEL_COUNT> mBuffer;
-};
\ No newline at end of file
+    // Small fields ahead of the framebuffer; one byte per pixel keeps the buffer
+    // of a lores machine to 2 KB
+    BasicRAM<Geometry>* mRAM = nullptr;
+    uint64_t mRevision = 0;
+    uint8_t mPlaneMask = kFirstPlane;
+    bool mIsHires = false;
+    std::array<uint8_t, Geometry::kDisplayPixelCount> mBuffer;
+};
@@ -9,6 +9,7 @@
 #include <optional>
 #include <array>
 #include <cassert>
+#include <cstdint>
 
 //--------------------------------------------------------------------------------
 class Key
@@ -64,29 +65,27 @@ public:
         : mCurrKeyStates{}
         , mPrevKeyStates{}
         , mKeyMapping{}
-        , mInputProvider(nullptr)
     { }
 
-    void SetInputProvider(std::unique_ptr<IKeyInputProvider> inputProvider)
-    {
-        mInputProvider = std::move(inputProvider);
-    }
-
     void SetKeyBinding(Key key, uint8_t physicalKey)
     {
         mKeyMapping[key.GetValue()] = physicalKey;
     }
 
-    void PollKeypad()
+    // Instantiated for the provider's concrete type, so a final provider is
+    // queried without a virtual call per key. The caller owns the provider.
+    template <KeyInputSource TProvider>
+    void PollKeypad(const TProvider& inputProvider)
     {
         mPrevKeyStates = mCurrKeyStates;
-
         for (uint8_t i = 0; i < mCurrKeyStates.size(); ++i)
-        {            
-            const uint8_t physicalKey = mKeyMapping[i];
-            const bool isHeld = mInputProvider->IsKeyPressed(physicalKey);
+        {
+            mCurrKeyStates[i] = inputProvider.IsKeyPressed(mKeyMapping[i]);
+        }
 
-            mCurrKeyStates[i] = isHeld;
+        if (GetFirstKeyReleased().has_value())
+        {
+            ++mReleaseCount;
         }
     }
 
@@ -112,11 +111,26 @@ public:
         uint8_t index = key.GetValue();
         mPrevKeyStates[index] = mCurrKeyStates[index];
         mCurrKeyStates[index] = isPressed;
+
+        if (mPrevKeyStates[index] && !isPressed)
+        {
+            ++mReleaseCount;
+        }
+    }
+
+    // Counts polls and key updates that produced a release edge. A caller blocked
+    // on GetFirstKeyReleased only needs to look again once this changes.
+    uint64_t GetReleaseCount() const
+    {
+        return mReleaseCount;
     }
    
 private:
+    // Hot: read by Ex9E/ExA1/Fx0A and the key wait check
     std::array<bool, 16> mCurrKeyStates;
     std::array<bool, 16> mPrevKeyStates;
+    uint64_t mReleaseCount = 0;
+
+    // Cold: only used when polling the host, once per frame
     std::array<uint8_t, 16> mKeyMapping;
-    std::unique_ptr<IKeyInputProvider> mInputProvider;
 };
\ No newline at end of file
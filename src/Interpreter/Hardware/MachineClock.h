@@ -0,0 +1,64 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+
+// System
+#include <cassert>
+#include <cstdint>
+
+// The machine's emulated time: CPU cycles since reset, counting executed, skipped
+// and idle cycles alike. It is 64-bit and only ever moves forward (until reset),
+// so cycle numbers from traces, breakpoints and timers can be compared directly
+// however long the machine runs.
+//--------------------------------------------------------------------------------
+class MachineClock
+{
+public:
+	static constexpr uint32_t kDefaultFrequencyHz = static_cast<uint32_t>(CPU_FREQUENCY_HZ);
+
+	explicit MachineClock(uint32_t frequencyHz = kDefaultFrequencyHz)
+		: mFrequencyHz(frequencyHz)
+	{
+		assert(frequencyHz > 0 && "Clock frequency must be positive");
+	}
+
+	uint64_t GetCycles() const { return mCycles; }
+	uint32_t GetFrequencyHz() const { return mFrequencyHz; }
+
+	void Advance(uint64_t cycles) { mCycles += cycles; }
+	void Reset() { mCycles = 0; }
+
+	// Converts the cycle count to the new rate, rounding down to a whole cycle,
+	// so emulated time and the ticks placed on it carry on across the change.
+	void SetFrequencyHz(uint32_t frequencyHz)
+	{
+		assert(frequencyHz > 0 && "Clock frequency must be positive");
+		mCycles = mCycles * frequencyHz / mFrequencyHz;
+		mFrequencyHz = frequencyHz;
+	}
+
+	// Conversions between cycles and emulated time
+	double ToSeconds(uint64_t cycles) const { return static_cast<double>(cycles) / mFrequencyHz; }
+	uint64_t ToMicroseconds(uint64_t cycles) const { return cycles * 1'000'000 / mFrequencyHz; }
+	uint64_t FromMicroseconds(uint64_t microseconds) const { return microseconds * mFrequencyHz / 1'000'000; }
+
+	// Ticks of a periodic signal at tickFrequencyHz (e.g. the 60 Hz timers) that
+	// have fallen due by a cycle, and the first cycle by which a tick has. Tick n
+	// falls due once n / tickFrequencyHz seconds have elapsed.
+	uint64_t CountTicks(uint64_t cycles, uint32_t tickFrequencyHz) const
+	{
+		return cycles * tickFrequencyHz / mFrequencyHz;
+	}
+
+	uint64_t GetTickCycle(uint64_t tick, uint32_t tickFrequencyHz) const
+	{
+		return (tick * mFrequencyHz + tickFrequencyHz - 1) / tickFrequencyHz;
+	}
+
+private:
+	uint32_t mFrequencyHz;
+	uint64_t mCycles = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+
+// System
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Compile-time machine dimensions. The hardware below, and the CPU, interpreter,
+// caches and engines built on it (see MACHINE_LIST), take one of these as a
+// template parameter, so each configuration gets its own code with every size,
+// mask and stride folded to a constant.
+//
+//   kDisplayWidth/kDisplayHeight   Framebuffer size in pixels
+//   kRamSize                       Addressable bytes; addresses wrap at this size
+//   kStackSize                     Return addresses the call stack holds
+//
+// RAM and stack sizes must be powers of two so wrapping is a mask.
+//--------------------------------------------------------------------------------
+template <uint32_t Width, uint32_t Height, size_t RamSize, uint32_t StackSize>
+struct MachineGeometry
+{
+	static_assert(std::has_single_bit(RamSize) && RamSize <= 0x10000, "RAM must be a power of two addressable in 16 bits");
+	static_assert(std::has_single_bit(StackSize), "Stack size must be a power of two");
+	static_assert(RamSize > PROGRAM_START_ADDRESS, "RAM must extend past the program start");
+
+	static constexpr uint32_t kDisplayWidth = Width;
+	static constexpr uint32_t kDisplayHeight = Height;
+	static constexpr size_t kDisplayPixelCount = static_cast<size_t>(Width) * Height;
+
+	static constexpr size_t kRamSize = RamSize;
+	static constexpr uint16_t kAddressMask = static_cast<uint16_t>(RamSize - 1);
+
+	static constexpr uint32_t kStackSize = StackSize;
+	static constexpr uint32_t kStackIndexMask = StackSize - 1;
+};
+
+// Standard configurations
+//--------------------------------------------------------------------------------
+using Chip8Geometry = MachineGeometry<DISPLAY_WIDTH, DISPLAY_HEIGHT, RAM_SIZE, STACK_SIZE>; // 64x32, 4 KB
+using SuperChipGeometry = MachineGeometry<128, 64, RAM_SIZE, STACK_SIZE>;                  // 128x64 hires, 4 KB
+using XoChipGeometry = MachineGeometry<128, 64, 0x10000, STACK_SIZE>;                      // 128x64, 64 KB
+
+// Expands X(Geometry) once per configuration, e.g. for explicit instantiations.
+#define MACHINE_GEOMETRY_LIST(X) \
+	X(Chip8Geometry) \
+	X(SuperChipGeometry) \
+	X(XoChipGeometry)
+
+// Hardware templated on the geometry (the CPU state on its stack depth alone).
+// The unqualified names are the CHIP-8 configuration.
+//--------------------------------------------------------------------------------
+template <typename Geometry> class BasicRAM;
+template <typename Geometry> class BasicDisplay;
+template <uint32_t StackSize> struct BasicCPUState;
+template <typename Geometry> struct BasicBus;
+
+using RAM = BasicRAM<Chip8Geometry>;
+using Display = BasicDisplay<Chip8Geometry>;
+using CPUState = BasicCPUState<Chip8Geometry::kStackSize>;
+using Bus = BasicBus<Chip8Geometry>;
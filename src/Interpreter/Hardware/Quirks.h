@@ -0,0 +1,110 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Types/ExecutionMode.h"
+#include "Types/QuirkProfile.h"
+
+// System
+#include <concepts>
+
+// Compile-time quirk policies. Opcode handlers whose behaviour differs between
+// interpreters take one of these as a template parameter, so every profile gets
+// its own instantiation and no handler tests a quirk flag at runtime.
+//
+//   kShiftReadsVy            8xy6/8xyE shift Vy into Vx instead of shifting Vx
+//   kLoadStoreAdvancesIndex  Fx55/Fx65 leave I pointing past the last register
+//   kJumpAddsVx              Bxnn jumps to xnn + Vx instead of nnn + V0
+//   kLogicResetsFlag         8xy1/8xy2/8xy3 clear VF
+//
+// A policy also fixes the execution mode: kIsChecked is only set by Checked<>.
+// Policies are independent of the machine they run on; the random source is a
+// parameter of the CPU (see BasicCPU).
+//--------------------------------------------------------------------------------
+template <typename T>
+concept QuirkPolicy = requires
+{
+	{ T::kProfile } -> std::convertible_to<QuirkProfile>;
+	{ T::kShiftReadsVy } -> std::convertible_to<bool>;
+	{ T::kLoadStoreAdvancesIndex } -> std::convertible_to<bool>;
+	{ T::kJumpAddsVx } -> std::convertible_to<bool>;
+	{ T::kLogicResetsFlag } -> std::convertible_to<bool>;
+	{ T::kIsChecked } -> std::convertible_to<bool>;
+};
+
+//--------------------------------------------------------------------------------
+struct ModernQuirks
+{
+	static constexpr QuirkProfile kProfile = QuirkProfile::kModern;
+	static constexpr bool kShiftReadsVy = false;
+	static constexpr bool kLoadStoreAdvancesIndex = false;
+	static constexpr bool kJumpAddsVx = false;
+	static constexpr bool kLogicResetsFlag = false;
+	static constexpr bool kIsChecked = false;
+};
+
+//--------------------------------------------------------------------------------
+struct CosmacQuirks
+{
+	static constexpr QuirkProfile kProfile = QuirkProfile::kCosmac;
+	static constexpr bool kShiftReadsVy = true;
+	static constexpr bool kLoadStoreAdvancesIndex = true;
+	static constexpr bool kJumpAddsVx = false;
+	static constexpr bool kLogicResetsFlag = true;
+	static constexpr bool kIsChecked = false;
+};
+
+//--------------------------------------------------------------------------------
+struct SchipQuirks
+{
+	static constexpr QuirkProfile kProfile = QuirkProfile::kSchip;
+	static constexpr bool kShiftReadsVy = false;
+	static constexpr bool kLoadStoreAdvancesIndex = false;
+	static constexpr bool kJumpAddsVx = true;
+	static constexpr bool kLogicResetsFlag = false;
+	static constexpr bool kIsChecked = false;
+};
+
+// The same quirks with every memory and stack access validated (ExecutionMode::kChecked).
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks>
+struct Checked : Quirks
+{
+	static constexpr bool kIsChecked = true;
+};
+
+using CheckedModernQuirks = Checked<ModernQuirks>;
+using CheckedCosmacQuirks = Checked<CosmacQuirks>;
+using CheckedSchipQuirks = Checked<SchipQuirks>;
+
+// Calls visitor.template operator()<Policy>() for the policy matching profile
+// and mode. This is the one place the runtime selection becomes a compile-time one.
+//--------------------------------------------------------------------------------
+template <typename Visitor>
+decltype(auto) VisitQuirkPolicy(QuirkProfile profile, ExecutionMode mode, Visitor&& visitor)
+{
+	const bool isChecked = (mode == ExecutionMode::kChecked);
+
+	switch (profile)
+	{
+		case QuirkProfile::kCosmac:
+			return isChecked ? visitor.template operator()<CheckedCosmacQuirks>() : visitor.template operator()<CosmacQuirks>();
+		case QuirkProfile::kSchip:
+			return isChecked ? visitor.template operator()<CheckedSchipQuirks>() : visitor.template operator()<SchipQuirks>();
+		case QuirkProfile::kModern:
+		default:
+			return isChecked ? visitor.template operator()<CheckedModernQuirks>() : visitor.template operator()<ModernQuirks>();
+	}
+}
+
+// Expands X(Policy) once per policy, e.g. for explicit instantiations. Further
+// arguments are passed on after the policy, e.g. X(Policy, TRandom) to
+// instantiate on one machine configuration (see MACHINE_LIST).
+#define QUIRK_POLICY_LIST(X, ...) \
+	X(ModernQuirks __VA_OPT__(,) __VA_ARGS__) \
+	X(CosmacQuirks __VA_OPT__(,) __VA_ARGS__) \
+	X(SchipQuirks __VA_OPT__(,) __VA_ARGS__) \
+	X(CheckedModernQuirks __VA_OPT__(,) __VA_ARGS__) \
+	X(CheckedCosmacQuirks __VA_OPT__(,) __VA_ARGS__) \
+	X(CheckedSchipQuirks __VA_OPT__(,) __VA_ARGS__)
@@ -7,21 +7,25 @@
 #include <cassert>
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] uint8_t RAM::Read(uint16_t address) const
+template <typename Geometry>
+[[nodiscard]] uint8_t BasicRAM<Geometry>::Read(uint16_t address) const
 {
-    assert(address < RAM_SIZE);
+    assert(address < kSize);
     return mData[address];
 }
 
 //--------------------------------------------------------------------------------
-void RAM::Write(uint16_t address, uint8_t value)
+template <typename Geometry>
+void BasicRAM<Geometry>::Write(uint16_t address, uint8_t value)
 {
-    assert(address < RAM_SIZE);
+    assert(address < kSize);
     mData[address] = value;
+    NotifyWrite(address, 1);
 }
 
 //--------------------------------------------------------------------------------
-[[nodiscard]] bool RAM::WriteRange(size_t start, std::span<const uint8_t> data)
+template <typename Geometry>
+[[nodiscard]] bool BasicRAM<Geometry>::WriteRange(size_t start, std::span<const uint8_t> data)
 {
     if (start + data.size() > mData.size()) 
     {
@@ -29,11 +33,112 @@ void RAM::Write(uint16_t address, uint8_t value)
     }
 
     std::copy(data.begin(), data.end(), mData.begin() + start);
+    NotifyWrite(start, data.size());
     return true;
 }
 
+// True if RAM from start holds exactly data (false if it would run past the end).
 //--------------------------------------------------------------------------------
-void RAM::ClearProgramMemory()
+template <typename Geometry>
+[[nodiscard]] bool BasicRAM<Geometry>::Equals(size_t start, std::span<const uint8_t> data) const
+{
+    if (start + data.size() > mData.size())
+    {
+        return false;
+    }
+
+    return std::equal(data.begin(), data.end(), mData.begin() + start);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+[[nodiscard]] std::span<const uint8_t> BasicRAM<Geometry>::View(size_t start, size_t length) const
+{
+    if (start + length > mData.size())
+    {
+        return { };
+    }
+
+    return std::span<const uint8_t>(mData).subspan(start, length);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+[[nodiscard]] bool BasicRAM<Geometry>::ReadRange(size_t start, std::span<uint8_t> destination) const
+{
+    if (start + destination.size() > mData.size())
+    {
+        return false;
+    }
+
+    std::copy_n(mData.begin() + start, destination.size(), destination.begin());
+    return true;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::CopyTo(std::span<uint8_t, kSize> destination) const
+{
+    std::copy(mData.begin(), mData.end(), destination.begin());
+}
+
+// Copies up to the end of RAM, then the remainder from address 0.
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::ReadWrapped(uint16_t start, std::span<uint8_t> destination) const
+{
+    assert(destination.size() <= kSize);
+
+    const size_t first = start & kAddressMask;
+    const size_t head = std::min(destination.size(), kSize - first);
+
+    std::copy_n(mData.begin() + first, head, destination.begin());
+    std::copy_n(mData.begin(), destination.size() - head, destination.begin() + head);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::WriteWrapped(uint16_t start, std::span<const uint8_t> data)
+{
+    assert(data.size() <= kSize);
+
+    const size_t first = start & kAddressMask;
+    const size_t head = std::min(data.size(), kSize - first);
+
+    std::copy_n(data.begin(), head, mData.begin() + first);
+    NotifyWrite(first, head);
+
+    if (head < data.size())
+    {
+        std::copy(data.begin() + head, data.end(), mData.begin());
+        NotifyWrite(0, data.size() - head);
+    }
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::ClearProgramMemory()
 {
     std::fill(mData.begin() + PROGRAM_START_ADDRESS, mData.end(), 0);
-}
\ No newline at end of file
+    NotifyWrite(PROGRAM_START_ADDRESS, kSize - PROGRAM_START_ADDRESS);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::AddWriteListener(IMemoryWriteListener& listener)
+{
+    mWriteListeners.push_back(&listener);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicRAM<Geometry>::NotifyWrite(size_t address, size_t length)
+{
+    for (IMemoryWriteListener* listener : mWriteListeners)
+    {
+        listener->OnMemoryWritten(address, length);
+    }
+}
+
+#define INSTANTIATE_RAM(Geometry) template class BasicRAM<Geometry>;
+MACHINE_GEOMETRY_LIST(INSTANTIATE_RAM)
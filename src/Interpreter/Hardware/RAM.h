@@ -4,21 +4,51 @@
 //--------------------------------------------------------------------------------
 // Interpreter
 #include "Constants.h"
+#include "Interfaces/IMemoryWriteListener.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
 
 // System
 #include <array>
 #include <cstdint>
 #include <span>
+#include <vector>
 
+// Byte-addressable memory of Geometry::kRamSize bytes. Member definitions live in
+// RAM.cpp, instantiated for each MACHINE_GEOMETRY_LIST entry.
 //--------------------------------------------------------------------------------
-class RAM 
+template <typename Geometry>
+class BasicRAM
 {
 public:
+    static constexpr size_t kSize = Geometry::kRamSize;
+    static constexpr uint16_t kAddressMask = Geometry::kAddressMask;
+
     [[nodiscard]] uint8_t Read(uint16_t address) const;
     void Write(uint16_t address, uint8_t value);
     [[nodiscard]] bool WriteRange(size_t start, std::span<const uint8_t> data);
+    [[nodiscard]] bool Equals(size_t start, std::span<const uint8_t> data) const;
+
+    // Block access: one bounds check per block rather than per byte. These fail
+    // (false, or an empty view) if the block would run past the end of RAM.
+    [[nodiscard]] std::span<const uint8_t> View(size_t start, size_t length) const;
+    [[nodiscard]] bool ReadRange(size_t start, std::span<uint8_t> destination) const;
+    void CopyTo(std::span<uint8_t, kSize> destination) const;
+
+    // As ReadRange/WriteRange, but addresses wrap past the end of RAM like the
+    // address bus. Blocks are at most kSize bytes.
+    void ReadWrapped(uint16_t start, std::span<uint8_t> destination) const;
+    void WriteWrapped(uint16_t start, std::span<const uint8_t> data);
     void ClearProgramMemory();
 
+    // Listeners are notified after every write so derived data (e.g. decoded
+    // instructions) can be invalidated. Listeners must outlive the RAM.
+    void AddWriteListener(IMemoryWriteListener& listener);
+
 private:
-    std::array<uint8_t, RAM_SIZE> mData{ };
+    void NotifyWrite(size_t address, size_t length);
+
+    // Read on every write, so kept ahead of the data next to the bus's other
+    // small fields rather than 4 KB behind them
+    std::vector<IMemoryWriteListener*> mWriteListeners;
+    std::array<uint8_t, kSize> mData{ };
 };
@@ -0,0 +1,6 @@
+#include "Interpreter/Hardware/RandomProvider.h"
+
+//--------------------------------------------------------------------------------
+RandomProvider::RandomProvider()
+    : mEngine(std::random_device{}())
+{ }
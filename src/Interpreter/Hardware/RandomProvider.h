@@ -0,0 +1,27 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interfaces/IRandomProvider.h"
+
+// System
+#include <random>
+
+// The machine's own random source. Final and defined inline, so a CPU built for
+// it (see MACHINE_LIST) calls it without a virtual call.
+//--------------------------------------------------------------------------------
+class RandomProvider final : public IRandomProvider
+{
+public:
+	RandomProvider();
+
+	uint8_t GetRandomByte() override
+	{
+		return static_cast<uint8_t>(mDistribution(mEngine));
+	}
+
+private:
+	std::mt19937 mEngine;
+	std::uniform_int_distribution<uint32_t> mDistribution{ 0, 255 };
+};
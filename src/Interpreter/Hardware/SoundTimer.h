@@ -1,7 +1,49 @@
 #pragma once
 
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// XO-CHIP audio: the 1-bit, 128-sample pattern the buzzer plays while the sound
+// timer runs (F002) and the pitch it is played at (Fx3A). The timer itself is
+// part of CPUState. Other programs never change either, so they keep the
+// power-on square wave at 4000 samples per second.
 //--------------------------------------------------------------------------------
 class SoundTimer
 {
+public:
+	static constexpr size_t kPatternBytes = 16;
+	static constexpr uint8_t kDefaultPitch = 64;
+	using Pattern = std::array<uint8_t, kPatternBytes>;
+
+	// Half the samples on, half off
+	static constexpr Pattern kDefaultPattern = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+	void Reset()
+	{
+		mPattern = kDefaultPattern;
+		mPitch = kDefaultPitch;
+	}
+
+	void LoadPattern(std::span<const uint8_t, kPatternBytes> pattern) { std::copy(pattern.begin(), pattern.end(), mPattern.begin()); }
+	const Pattern& GetPattern() const { return mPattern; }
+
+	void SetPitch(uint8_t pitch) { mPitch = pitch; }
+	uint8_t GetPitch() const { return mPitch; }
+
+	// Samples per second: 4000 at the default pitch, doubling every 48 steps
+	double GetPlaybackRate() const
+	{
+		return 4000.0 * std::exp2((mPitch - kDefaultPitch) / 48.0);
+	}
 
-};
\ No newline at end of file
+private:
+	Pattern mPattern = kDefaultPattern;
+	uint8_t mPitch = kDefaultPitch;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+// Includes
+//------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/CPUState.h"
+#include "Interpreter/Instruction/Instruction.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+
+// System
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Instruction costs of the original COSMAC VIP interpreter, in 1802 machine
+// cycles (8 clocks of the 1.76064 MHz CPU clock). Every instruction pays the
+// interpreter's fetch and decode loop plus the cost of its routine. The figures
+// are approximate timings of the VIP interpreter's routines; the display
+// interrupt a VIP draw waits on is not modelled.
+//------------------------------------------------------------------------------
+namespace CosmacVipTiming
+{
+    inline constexpr uint32_t kMachineCycleHz = 1'760'640 / 8;
+    inline constexpr uint32_t kFetchDecodeCycles = 40;
+
+    // Dxyn: setup, then a cost per sprite row that is higher when the sprite is
+    // not byte-aligned and each row has to be shifted across two display bytes
+    inline constexpr uint32_t kDrawSetupCycles = 26;
+    inline constexpr uint32_t kDrawAlignedRowCycles = 46;
+    inline constexpr uint32_t kDrawUnalignedRowCycles = 68;
+
+    // Fx55 / Fx65: setup, then a cost per register copied
+    inline constexpr uint32_t kRegisterCopySetupCycles = 14;
+    inline constexpr uint32_t kRegisterCopyCycles = 14;
+
+    // Routine cost by OpcodeId, excluding fetch/decode and the per-row or
+    // per-register parts above. The VIP never ran the SUPER-CHIP and XO-CHIP
+    // opcodes, which are left at zero (fetch and decode only).
+    inline constexpr std::array<uint16_t, static_cast<size_t>(OpcodeId::UNASSIGNED)> kRoutineCycles = {
+        0,    // SYS_ADDR
+        24,   // CLS
+        10,   // RET
+        12,   // JP_ADDR
+        26,   // CALL_ADDR
+        10,   // SE_VX_KK
+        10,   // SNE_VX_KK
+        14,   // SE_VX_VY
+        6,    // LD_VX_KK
+        10,   // ADD_VX_KK
+        44,   // LD_VX_VY
+        44,   // OR_VX_VY
+        44,   // AND_VX_VY
+        44,   // XOR_VX_VY
+        44,   // ADD_VX_VY
+        44,   // SUB_VX_VY
+        44,   // SHR_VX_VY
+        44,   // SUBN_VX_VY
+        44,   // SHL_VX_VY
+        14,   // SNE_VX_VY
+        12,   // LD_I_ADDR
+        22,   // JP_V0_ADDR
+        36,   // RND_VX_KK
+        0,    // DRW_VX_VY_N (per row, see above)
+        14,   // SKP_VX
+        14,   // SKNP_VX
+        10,   // LD_VX_DT
+        19,   // LD_VX_K
+        10,   // LD_DT_VX
+        10,   // LD_ST_VX
+        16,   // ADD_I_VX
+        16,   // LD_F_VX
+        84,   // LD_B_VX
+        0,    // LD_I_VX (per register, see above)
+        0,    // LD_VX_I (per register, see above)
+    };
+
+    // Cost of executing the instruction from the given state (read before it runs).
+    //------------------------------------------------------------------------------
+    inline uint32_t GetCycleCost(const Instruction& instruction, const CPUState& state)
+    {
+        const OpcodeId opcodeId = instruction.GetOpcodeId();
+        uint32_t cycles = kFetchDecodeCycles + kRoutineCycles[static_cast<size_t>(opcodeId)];
+
+        switch (opcodeId)
+        {
+            case OpcodeId::DRW_VX_VY_N:
+            {
+                const bool isAligned = (state.mRegisters[instruction.GetOperandX()] % SPRITE_ROW_WIDTH) == 0;
+                const uint32_t rowCycles = isAligned ? kDrawAlignedRowCycles : kDrawUnalignedRowCycles;
+                cycles += kDrawSetupCycles + rowCycles * instruction.GetOperandN();
+                break;
+            }
+
+            case OpcodeId::LD_I_VX:
+            case OpcodeId::LD_VX_I:
+                cycles += kRegisterCopySetupCycles + kRegisterCopyCycles * static_cast<uint32_t>(instruction.GetOperandX() + 1);
+                break;
+
+            default:
+                break;
+        }
+
+        return cycles;
+    }
+}
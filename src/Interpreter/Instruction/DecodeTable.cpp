@@ -0,0 +1,11 @@
+#include "Interpreter/Instruction/DecodeTable.h"
+
+/*
+    Build() is a constant expression, so compilers constant-initialize the tables
+    into read-only data. Where a compiler's constexpr step limit is too small for
+    64K entries (e.g. MSVC defaults), it falls back to static initialization.
+*/
+//------------------------------------------------------------------------------
+const DecodeTable::Table DecodeTable::mChip8Table = DecodeTable::Build(InstructionSet::kChip8);
+const DecodeTable::Table DecodeTable::mSuperChipTable = DecodeTable::Build(InstructionSet::kSuperChip);
+const DecodeTable::Table DecodeTable::mXoChipTable = DecodeTable::Build(InstructionSet::kXoChip);
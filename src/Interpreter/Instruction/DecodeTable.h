@@ -0,0 +1,88 @@
+#pragma once
+
+// Includes
+//------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Instruction/OpcodeId.h"
+#include "Interpreter/Instruction/OpcodeTable.h"
+#include "Types/InstructionSet.h"
+
+// System
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Maps every possible 16-bit opcode directly to its OpcodeId, replacing the
+// linear mask/pattern scan over OpcodeTable::All() with a single indexed load.
+//
+// Each instruction set has its own table, built once. Callers pick one when a
+// ROM is loaded and index it directly, so decoding never asks which set is in
+// use and adding opcodes to one set costs the others nothing.
+//------------------------------------------------------------------------------
+class DecodeTable
+{
+public:
+    static constexpr size_t kOpcodeCount = 0x10000;
+    using Table = std::array<OpcodeId, kOpcodeCount>;
+
+    // Returns UNASSIGNED if the opcode is not decodable as base CHIP-8.
+    static OpcodeId Lookup(uint16_t opcode)
+    {
+        return mChip8Table[opcode];
+    }
+
+    static const Table& Get(InstructionSet instructionSet)
+    {
+        switch (instructionSet)
+        {
+            case InstructionSet::kSuperChip: return mSuperChipTable;
+            case InstructionSet::kXoChip:    return mXoChipTable;
+            case InstructionSet::kChip8:
+            default:                         return mChip8Table;
+        }
+    }
+
+    static constexpr Table Build(InstructionSet instructionSet)
+    {
+        /*
+            Specs are applied from the least to the most specific mask so that the
+            narrower pattern wins where two overlap, e.g. CLS and RET over SYS.
+            This matches OpcodeTable::Match for every opcode.
+        */
+
+        Table table{ };
+        table.fill(OpcodeId::UNASSIGNED);
+
+        for (int maskBits = 0; maskBits <= 16; ++maskBits)
+        {
+            for (const OpcodeSpec& spec : OpcodeTable::All())
+            {
+                if (!spec.IsPartOf(instructionSet) || std::popcount(spec.mMask) != maskBits)
+                {
+                    continue;
+                }
+
+                // Enumerate every combination of the bits not covered by the mask
+                const uint16_t freeBits = static_cast<uint16_t>(~spec.mMask);
+                uint16_t subset = freeBits;
+                while (true)
+                {
+                    table[spec.mPattern | subset] = spec.mOpcodeId;
+                    if (subset == 0)
+                    {
+                        break;
+                    }
+                    subset = static_cast<uint16_t>((subset - 1) & freeBits);
+                }
+            }
+        }
+
+        return table;
+    }
+
+private:
+    static const Table mChip8Table;
+    static const Table mSuperChipTable;
+    static const Table mXoChipTable;
+};
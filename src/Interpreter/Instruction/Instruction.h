@@ -6,48 +6,57 @@
 #include "Interpreter/Instruction/OpcodeId.h"
 
 // System
-#include <string>
-#include <vector>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 //--------------------------------------------------------------------------------
 class Instruction
 {
-    // Operand indices
-    static constexpr size_t kOperandNNN = 0;
-    static constexpr size_t kOperandKK = 1;
-    static constexpr size_t kOperandX = 0;
-    static constexpr size_t kOperandY = 1;
-    static constexpr size_t kOperandN = 2;
-
-    // Operand masks (for clarity only  Decode opcode already ensures correct bit widths).
+    // Operand masks and shifts (the decode masks bound every field to its bit width).
     static constexpr uint16_t kMaskNNN = 0x0FFF; // 12-bit address
     static constexpr uint16_t kMaskKK = 0x00FF;  // 8-bit byte
     static constexpr uint16_t kMaskN = 0x000F;   // 4-bit nibble
-    static constexpr uint16_t kMaskXY = 0x000F;  // 4-bit nibble (used for register indices)
+    static constexpr uint16_t kMaskX = 0x0F00;   // 4-bit register index
+    static constexpr uint16_t kMaskY = 0x00F0;   // 4-bit register index
+    static constexpr uint8_t kShiftX = 8;
+    static constexpr uint8_t kShiftY = 4;
 
 public:
-    Instruction();
-    Instruction(const OpcodeId opcodeId, const std::vector<uint16_t>& operands);
+    constexpr Instruction() = default;
+
+    constexpr Instruction(const OpcodeId opcodeId, const uint16_t opcode)
+        : mOpcode(opcode)
+        , mOpcodeId(opcodeId)
+        , mX(static_cast<uint8_t>((opcode & kMaskX) >> kShiftX))
+        , mY(static_cast<uint8_t>((opcode & kMaskY) >> kShiftY))
+        , mN(static_cast<uint8_t>(opcode & kMaskN))
+        , mKK(static_cast<uint8_t>(opcode & kMaskKK))
+    {
+        assert(opcodeId != OpcodeId::UNASSIGNED);
+    }
 
     OpcodeId GetOpcodeId() const { return mOpcodeId; }
+    uint16_t GetOpcode() const { return mOpcode; }
     bool IsValid() const { return mOpcodeId != OpcodeId::UNASSIGNED; }
-    size_t OperandCount() const { return mOperands.size(); }
 
     // Operand accessors
-    uint16_t GetOperandNNN() const { return GetMaskedOperand<uint16_t>(kOperandNNN, kMaskNNN); }
-    uint8_t GetOperandKK() const { return GetMaskedOperand<uint8_t>(kOperandKK, kMaskKK); }
-    uint8_t GetOperandN() const { return GetMaskedOperand<uint8_t>(kOperandN, kMaskN); }
-    size_t  GetOperandX() const { return GetMaskedOperand<size_t>(kOperandX, kMaskXY); }
-    size_t  GetOperandY() const { return GetMaskedOperand<size_t>(kOperandY, kMaskXY); }
+    uint16_t GetOperandNNN() const { return mOpcode & kMaskNNN; }
+    uint8_t GetOperandKK() const { return mKK; }
+    uint8_t GetOperandN() const { return mN; }
+    size_t  GetOperandX() const { return mX; }
+    size_t  GetOperandY() const { return mY; }
 
 private:
-    template<typename T>
-    T GetMaskedOperand(size_t index, uint16_t bitMask) const
-    {
-        return static_cast<T>(mOperands.at(index) & bitMask);
-    }
-
-    OpcodeId mOpcodeId;
-    std::vector<uint16_t> mOperands;
-};
\ No newline at end of file
+    // Fields are pre-extracted at decode time so handlers never mask or shift.
+    uint16_t mOpcode = 0;
+    OpcodeId mOpcodeId = OpcodeId::UNASSIGNED;
+    uint8_t mX = 0;
+    uint8_t mY = 0;
+    uint8_t mN = 0;
+    uint8_t mKK = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<Instruction>, "Instruction must stay trivially copyable");
+static_assert(sizeof(Instruction) <= sizeof(uint64_t), "Instruction must fit in a register");
@@ -0,0 +1,62 @@
+#include "Interpreter/Instruction/InstructionCache.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <algorithm>
+#include <cassert>
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicInstructionCache<Geometry>::Store(uint16_t address, const Instruction& instruction)
+{
+    assert(address >= PROGRAM_START_ADDRESS && address % INSTRUCTION_SIZE == 0);
+
+    const size_t index = (address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+    if (index < kEntryCount)
+    {
+        mEntries[index] = instruction;
+    }
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicInstructionCache<Geometry>::Clear()
+{
+    mEntries.fill({ });
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicInstructionCache<Geometry>::ResetCounters()
+{
+    mHitCount = 0;
+    mMissCount = 0;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+void BasicInstructionCache<Geometry>::OnMemoryWritten(size_t address, size_t length)
+{
+    /*
+        An entry at aligned address A decodes bytes A and A + 1, so any written
+        byte invalidates the entry whose aligned address is at or just below it.
+    */
+
+    const size_t end = address + length;
+    if (length == 0 || end <= PROGRAM_START_ADDRESS)
+    {
+        return;
+    }
+
+    const size_t first = (std::max<size_t>(address, PROGRAM_START_ADDRESS) - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+    const size_t last = std::min((end - 1 - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE, kEntryCount - 1);
+
+    for (size_t index = first; index <= last; ++index)
+    {
+        mEntries[index] = { };
+    }
+}
+
+#define INSTANTIATE_INSTRUCTION_CACHE(Geometry) template class BasicInstructionCache<Geometry>;
+MACHINE_GEOMETRY_LIST(INSTANTIATE_INSTRUCTION_CACHE)
@@ -0,0 +1,66 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interfaces/IMemoryWriteListener.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Interpreter/Instruction/Instruction.h"
+
+// System
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Per-address cache of decoded instructions for the program region.
+// Entries are invalidated through RAM write notifications, so self-modifying
+// code (Fx55, Fx33) and ROM loads are always re-decoded. Sized for the program
+// region of Geometry::kRamSize bytes.
+//--------------------------------------------------------------------------------
+template <typename Geometry>
+class BasicInstructionCache : public IMemoryWriteListener
+{
+public:
+    static constexpr size_t kEntryCount = (Geometry::kRamSize - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+
+    // Returns the cached instruction, or an invalid instruction on a miss. The
+    // address is not validated: it must be fetchable (see CPU::IsFetchable) or
+    // kRamSize, the one address a +2 step from a fetchable one can reach, which
+    // always misses.
+    [[nodiscard]] Instruction Lookup(uint16_t address)
+    {
+        const Instruction& instruction = mEntries[(address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE];
+        if (instruction.IsValid())
+        {
+            ++mHitCount;
+            return instruction;
+        }
+
+        ++mMissCount;
+        return { };
+    }
+
+    // As Lookup, but for look-ahead that is not a fetch: the hit and miss
+    // counters are left alone.
+    [[nodiscard]] Instruction Peek(uint16_t address) const
+    {
+        return mEntries[(address - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE];
+    }
+
+    void Store(uint16_t address, const Instruction& instruction);
+    void Clear();
+    void ResetCounters();
+
+    void OnMemoryWritten(size_t address, size_t length) override;
+
+    uint64_t GetHitCount() const { return mHitCount; }
+    uint64_t GetMissCount() const { return mMissCount; }
+
+private:
+    std::array<Instruction, kEntryCount + 1> mEntries{ }; // The last entry stays empty
+    uint64_t mHitCount = 0;
+    uint64_t mMissCount = 0;
+};
+
+using InstructionCache = BasicInstructionCache<Chip8Geometry>;
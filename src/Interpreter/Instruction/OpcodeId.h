@@ -7,7 +7,8 @@
 #include <string>
 
 // Reference: http://devernay.free.fr/hacks/chip8/C8TECH10.HTM#4xkk (mapping)
-// This enum only covers the 3.1 base CHIP-8 instruction set.
+// The 3.1 base CHIP-8 instruction set comes first, then the SUPER-CHIP and
+// XO-CHIP extensions (see OpcodeTable for which set each belongs to).
 //--------------------------------------------------------------------------------
 enum class OpcodeId : uint8_t
 {
@@ -46,6 +47,27 @@ enum class OpcodeId : uint8_t
     LD_B_VX,       // Fx33
     LD_I_VX,       // Fx55
     LD_VX_I,       // Fx65
+
+    // SUPER-CHIP 1.1
+    SCD_N,         // 00Cn
+    SCR,           // 00FB
+    SCL,           // 00FC
+    EXIT,          // 00FD
+    LOW,           // 00FE
+    HIGH,          // 00FF
+    DRW16_VX_VY,   // Dxy0
+    LD_HF_VX,      // Fx30
+    LD_R_VX,       // Fx75
+    LD_VX_R,       // Fx85
+
+    // XO-CHIP
+    SCU_N,         // 00Dn
+    LD_I_VX_VY,    // 5xy2
+    LD_VX_VY_I,    // 5xy3
+    LD_I_LONG,     // F000 nnnn
+    PLANE_N,       // Fn01
+    AUDIO,         // F002
+    LD_PITCH_VX,   // Fx3A
     
     UNASSIGNED,    // Default value until pattern is decoded
 };
\ No newline at end of file
@@ -4,12 +4,15 @@
 //------------------------------------------------------------------------------
 // Interpreter
 #include "Interpreter/Instruction/OpcodeId.h"
+#include "Types/InstructionSet.h"
 
 // System
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <string>
-#include <unordered_map>
-#include <vector>
+#include <span>
 
 //------------------------------------------------------------------------------
 enum class OperandType
@@ -33,21 +36,174 @@ struct OperandSpec
 //------------------------------------------------------------------------------
 struct OpcodeSpec
 {
-	OpcodeId mOpcodeId = OpcodeId::UNASSIGNED;
+    static constexpr size_t kMaxOperands = 3;
+
+    OpcodeId mOpcodeId = OpcodeId::UNASSIGNED;
     uint16_t mMask = 0;
     uint16_t mPattern = 0;
     const char* mPatternStr = nullptr; // e.g. "8xy1"
     const char* mMnemonic = nullptr;   // e.g. "OR"
-    std::vector<OperandSpec> mOperands;
+    std::array<OperandSpec, kMaxOperands> mOperandStorage{ };
+    uint8_t mOperandCount = 0;
+    InstructionSet mInstructionSet = InstructionSet::kChip8; // First set with this opcode
+
+    constexpr std::span<const OperandSpec> GetOperands() const
+    {
+        return { mOperandStorage.data(), mOperandCount };
+    }
+
+    constexpr bool Matches(uint16_t opcode) const
+    {
+        return (opcode & mMask) == mPattern;
+    }
+
+    constexpr bool IsPartOf(InstructionSet instructionSet) const
+    {
+        return mInstructionSet <= instructionSet;
+    }
 };
 
+// Compile-time opcode table, indexed directly by OpcodeId.
 //------------------------------------------------------------------------------
 class OpcodeTable
 {
+    static constexpr size_t kCount = static_cast<size_t>(OpcodeId::UNASSIGNED);
+
+    static constexpr OperandSpec ARG_NNN{ 0x0FFF, 0, OperandType::NNN, "nnn" };
+    static constexpr OperandSpec ARG_KK{ 0x00FF, 0, OperandType::KK, "kk" };
+    static constexpr OperandSpec ARG_N{ 0x000F, 0, OperandType::N, "n" };
+    static constexpr OperandSpec ARG_X{ 0x0F00, 8, OperandType::X, "x" };
+    static constexpr OperandSpec ARG_Y{ 0x00F0, 4, OperandType::Y, "y" };
+    static constexpr OperandSpec ARG_PLANES{ 0x0F00, 8, OperandType::X, "n" }; // Fn01's plane mask
+
+    static constexpr std::array<OpcodeSpec, kCount> mTable = { {
+        { OpcodeId::SYS_ADDR,    0xF000, 0x0000, "0nnn", "SYS",  { ARG_NNN }, 1 },
+        { OpcodeId::CLS,         0xFFFF, 0x00E0, "00E0", "CLS",  { }, 0 },
+        { OpcodeId::RET,         0xFFFF, 0x00EE, "00EE", "RET",  { }, 0 },
+        { OpcodeId::JP_ADDR,     0xF000, 0x1000, "1nnn", "JP",   { ARG_NNN }, 1 },
+        { OpcodeId::CALL_ADDR,   0xF000, 0x2000, "2nnn", "CALL", { ARG_NNN }, 1 },
+        { OpcodeId::SE_VX_KK,    0xF000, 0x3000, "3xkk", "SE",   { ARG_X, ARG_KK }, 2 },
+        { OpcodeId::SNE_VX_KK,   0xF000, 0x4000, "4xkk", "SNE",  { ARG_X, ARG_KK }, 2 },
+        { OpcodeId::SE_VX_VY,    0xF00F, 0x5000, "5xy0", "SE",   { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::LD_VX_KK,    0xF000, 0x6000, "6xkk", "LD",   { ARG_X, ARG_KK }, 2 },
+        { OpcodeId::ADD_VX_KK,   0xF000, 0x7000, "7xkk", "ADD",  { ARG_X, ARG_KK }, 2 },
+        { OpcodeId::LD_VX_VY,    0xF00F, 0x8000, "8xy0", "LD",   { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::OR_VX_VY,    0xF00F, 0x8001, "8xy1", "OR",   { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::AND_VX_VY,   0xF00F, 0x8002, "8xy2", "AND",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::XOR_VX_VY,   0xF00F, 0x8003, "8xy3", "XOR",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::ADD_VX_VY,   0xF00F, 0x8004, "8xy4", "ADD",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::SUB_VX_VY,   0xF00F, 0x8005, "8xy5", "SUB",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::SHR_VX_VY,   0xF00F, 0x8006, "8xy6", "SHR",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::SUBN_VX_VY,  0xF00F, 0x8007, "8xy7", "SUBN", { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::SHL_VX_VY,   0xF00F, 0x800E, "8xyE", "SHL",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::SNE_VX_VY,   0xF00F, 0x9000, "9xy0", "SNE",  { ARG_X, ARG_Y }, 2 },
+        { OpcodeId::LD_I_ADDR,   0xF000, 0xA000, "Annn", "LD",   { ARG_NNN }, 1 },
+        { OpcodeId::JP_V0_ADDR,  0xF000, 0xB000, "Bnnn", "JP",   { ARG_NNN }, 1 },
+        { OpcodeId::RND_VX_KK,   0xF000, 0xC000, "Cxkk", "RND",  { ARG_X, ARG_KK }, 2 },
+        { OpcodeId::DRW_VX_VY_N, 0xF000, 0xD000, "Dxyn", "DRW",  { ARG_X, ARG_Y, ARG_N }, 3 },
+
+        { OpcodeId::SKP_VX,      0xF0FF, 0xE09E, "Ex9E", "SKP",  { ARG_X }, 1 },
+        { OpcodeId::SKNP_VX,     0xF0FF, 0xE0A1, "ExA1", "SKNP", { ARG_X }, 1 },
+        { OpcodeId::LD_VX_DT,    0xF0FF, 0xF007, "Fx07", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_VX_K,     0xF0FF, 0xF00A, "Fx0A", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_DT_VX,    0xF0FF, 0xF015, "Fx15", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_ST_VX,    0xF0FF, 0xF018, "Fx18", "LD",   { ARG_X }, 1 },
+        { OpcodeId::ADD_I_VX,    0xF0FF, 0xF01E, "Fx1E", "ADD",  { ARG_X }, 1 },
+        { OpcodeId::LD_F_VX,     0xF0FF, 0xF029, "Fx29", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_B_VX,     0xF0FF, 0xF033, "Fx33", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_I_VX,     0xF0FF, 0xF055, "Fx55", "LD",   { ARG_X }, 1 },
+        { OpcodeId::LD_VX_I,     0xF0FF, 0xF065, "Fx65", "LD",   { ARG_X }, 1 },
+
+        { OpcodeId::SCD_N,       0xFFF0, 0x00C0, "00Cn", "SCD",  { ARG_N }, 1, InstructionSet::kSuperChip },
+        { OpcodeId::SCR,         0xFFFF, 0x00FB, "00FB", "SCR",  { }, 0, InstructionSet::kSuperChip },
+        { OpcodeId::SCL,         0xFFFF, 0x00FC, "00FC", "SCL",  { }, 0, InstructionSet::kSuperChip },
+        { OpcodeId::EXIT,        0xFFFF, 0x00FD, "00FD", "EXIT", { }, 0, InstructionSet::kSuperChip },
+        { OpcodeId::LOW,         0xFFFF, 0x00FE, "00FE", "LOW",  { }, 0, InstructionSet::kSuperChip },
+        { OpcodeId::HIGH,        0xFFFF, 0x00FF, "00FF", "HIGH", { }, 0, InstructionSet::kSuperChip },
+        { OpcodeId::DRW16_VX_VY, 0xF00F, 0xD000, "Dxy0", "DRW",  { ARG_X, ARG_Y }, 2, InstructionSet::kSuperChip },
+        { OpcodeId::LD_HF_VX,    0xF0FF, 0xF030, "Fx30", "LD",   { ARG_X }, 1, InstructionSet::kSuperChip },
+        { OpcodeId::LD_R_VX,     0xF0FF, 0xF075, "Fx75", "LD",   { ARG_X }, 1, InstructionSet::kSuperChip },
+        { OpcodeId::LD_VX_R,     0xF0FF, 0xF085, "Fx85", "LD",   { ARG_X }, 1, InstructionSet::kSuperChip },
+
+        { OpcodeId::SCU_N,       0xFFF0, 0x00D0, "00Dn", "SCU",  { ARG_N }, 1, InstructionSet::kXoChip },
+        { OpcodeId::LD_I_VX_VY,  0xF00F, 0x5002, "5xy2", "LD",   { ARG_X, ARG_Y }, 2, InstructionSet::kXoChip },
+        { OpcodeId::LD_VX_VY_I,  0xF00F, 0x5003, "5xy3", "LD",   { ARG_X, ARG_Y }, 2, InstructionSet::kXoChip },
+        { OpcodeId::LD_I_LONG,   0xFFFF, 0xF000, "F000", "LD",   { }, 0, InstructionSet::kXoChip },
+        { OpcodeId::PLANE_N,     0xF0FF, 0xF001, "Fn01", "PLANE", { ARG_PLANES }, 1, InstructionSet::kXoChip },
+        { OpcodeId::AUDIO,       0xFFFF, 0xF002, "F002", "AUDIO", { }, 0, InstructionSet::kXoChip },
+        { OpcodeId::LD_PITCH_VX, 0xF0FF, 0xF03A, "Fx3A", "LD",   { ARG_X }, 1, InstructionSet::kXoChip },
+    } };
+
 public:
-    static const OpcodeSpec& Get(OpcodeId id);
-    static const std::vector<OpcodeSpec>& All();
+    static constexpr const OpcodeSpec& Get(OpcodeId opcodeId)
+    {
+        assert(opcodeId != OpcodeId::UNASSIGNED && "OpcodeId has no entry in OpcodeTable");
+        return mTable[static_cast<size_t>(opcodeId)];
+    }
+
+    static constexpr const std::array<OpcodeSpec, kCount>& All()
+    {
+        return mTable;
+    }
+
+    // Reference decoder over the specs of an instruction set. Where patterns overlap
+    // (SYS vs. CLS/RET, Dxyn vs. Dxy0), the spec with the most mask bits wins.
+    // Intended for table generation and compile-time checks.
+    static constexpr OpcodeId Match(uint16_t opcode, InstructionSet instructionSet = InstructionSet::kChip8)
+    {
+        OpcodeId bestId = OpcodeId::UNASSIGNED;
+        int bestMaskBits = -1;
+
+        for (const OpcodeSpec& spec : mTable)
+        {
+            const int maskBits = std::popcount(spec.mMask);
+            if (spec.IsPartOf(instructionSet) && spec.Matches(opcode) && maskBits > bestMaskBits)
+            {
+                bestId = spec.mOpcodeId;
+                bestMaskBits = maskBits;
+            }
+        }
+
+        return bestId;
+    }
 
-private:
-    static const std::vector<OpcodeSpec> mTable;
-};
\ No newline at end of file
+    static constexpr bool IsIndexedByOpcodeId()
+    {
+        for (size_t i = 0; i < mTable.size(); ++i)
+        {
+            if (static_cast<size_t>(mTable[i].mOpcodeId) != i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr bool AreSpecsWellFormed()
+    {
+        for (const OpcodeSpec& spec : mTable)
+        {
+            const bool patternWithinMask = (spec.mPattern & spec.mMask) == spec.mPattern;
+            const bool hasStrings = spec.mPatternStr != nullptr && spec.mMnemonic != nullptr;
+            if (!patternWithinMask || !hasStrings || spec.mOperandCount > OpcodeSpec::kMaxOperands)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Coverage checks
+//------------------------------------------------------------------------------
+static_assert(OpcodeTable::All().size() == static_cast<size_t>(OpcodeId::UNASSIGNED),
+    "OpcodeTable must have exactly one entry per OpcodeId");
+static_assert(OpcodeTable::IsIndexedByOpcodeId(),
+    "OpcodeTable entries must be ordered by OpcodeId");
+static_assert(OpcodeTable::AreSpecsWellFormed(),
+    "OpcodeTable entry has a pattern outside its mask or missing labels");
+static_assert(OpcodeTable::Match(0x00E0) == OpcodeId::CLS && OpcodeTable::Match(0x00EE) == OpcodeId::RET,
+    "CLS and RET must take precedence over SYS");
+static_assert(OpcodeTable::Match(0xFFFF) == OpcodeId::UNASSIGNED);
+static_assert(OpcodeTable::Match(0xD120) == OpcodeId::DRW_VX_VY_N && OpcodeTable::Match(0xD120, InstructionSet::kSuperChip) == OpcodeId::DRW16_VX_VY,
+    "Dxy0 must only draw 16x16 sprites from SUPER-CHIP on");
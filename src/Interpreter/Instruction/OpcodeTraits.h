@@ -0,0 +1,97 @@
+#pragma once
+
+// Includes
+//------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+
+// System
+#include <cstdint>
+
+// How an instruction affects the program counter beyond the normal +2 advance.
+//------------------------------------------------------------------------------
+enum class ControlFlow : uint8_t
+{
+    kSequential,   // Falls through to the next instruction
+    kJump,         // 1nnn
+    kCall,         // 2nnn
+    kReturn,       // 00EE
+    kIndirectJump, // Bnnn (target depends on V0)
+    kSkip,         // 3xkk, 4xkk, 5xy0, 9xy0, Ex9E, ExA1
+    kWaitForKey,   // Fx0A (may retry the same instruction)
+    kExit,         // 00FD (ends the program)
+    kLongLoad,     // F000 nnnn (steps over its operand word)
+};
+
+//------------------------------------------------------------------------------
+constexpr ControlFlow GetControlFlow(OpcodeId opcodeId)
+{
+    switch (opcodeId)
+    {
+        case OpcodeId::JP_ADDR:    return ControlFlow::kJump;
+        case OpcodeId::CALL_ADDR:  return ControlFlow::kCall;
+        case OpcodeId::RET:        return ControlFlow::kReturn;
+        case OpcodeId::JP_V0_ADDR: return ControlFlow::kIndirectJump;
+        case OpcodeId::SE_VX_KK:
+        case OpcodeId::SNE_VX_KK:
+        case OpcodeId::SE_VX_VY:
+        case OpcodeId::SNE_VX_VY:
+        case OpcodeId::SKP_VX:
+        case OpcodeId::SKNP_VX:    return ControlFlow::kSkip;
+        case OpcodeId::LD_VX_K:    return ControlFlow::kWaitForKey;
+        case OpcodeId::EXIT:       return ControlFlow::kExit;
+        case OpcodeId::LD_I_LONG:  return ControlFlow::kLongLoad;
+        default:                   return ControlFlow::kSequential;
+    }
+}
+
+// Bytes the instruction occupies: XO-CHIP's F000 nnnn is followed by its operand
+// word, every other instruction is one word.
+//------------------------------------------------------------------------------
+constexpr uint16_t GetInstructionLength(OpcodeId opcodeId)
+{
+    return opcodeId == OpcodeId::LD_I_LONG ? 2 * INSTRUCTION_SIZE : INSTRUCTION_SIZE;
+}
+
+// True if the instruction ends a basic block (anything but fall-through).
+//------------------------------------------------------------------------------
+constexpr bool EndsBasicBlock(OpcodeId opcodeId)
+{
+    return GetControlFlow(opcodeId) != ControlFlow::kSequential;
+}
+
+// True if the instruction stores to RAM (and may therefore modify code).
+//------------------------------------------------------------------------------
+constexpr bool WritesMemory(OpcodeId opcodeId)
+{
+    return opcodeId == OpcodeId::LD_B_VX || opcodeId == OpcodeId::LD_I_VX || opcodeId == OpcodeId::LD_I_VX_VY;
+}
+
+// True if the instruction affects anything beyond CPUState (display, RAM, timers,
+// audio, the random source) or blocks on input. Everything else is a pure function of
+// CPUState, RAM, the timers and the keypad.
+//------------------------------------------------------------------------------
+constexpr bool HasSideEffects(OpcodeId opcodeId)
+{
+    switch (opcodeId)
+    {
+        case OpcodeId::CLS:
+        case OpcodeId::DRW_VX_VY_N:
+        case OpcodeId::DRW16_VX_VY:
+        case OpcodeId::SCD_N:
+        case OpcodeId::SCU_N:
+        case OpcodeId::SCR:
+        case OpcodeId::SCL:
+        case OpcodeId::LOW:
+        case OpcodeId::HIGH:
+        case OpcodeId::PLANE_N:
+        case OpcodeId::AUDIO:
+        case OpcodeId::LD_PITCH_VX:
+        case OpcodeId::RND_VX_KK:
+        case OpcodeId::LD_VX_K:
+        case OpcodeId::LD_DT_VX:
+        case OpcodeId::LD_ST_VX:   return true;
+        default:                   return WritesMemory(opcodeId);
+    }
+}
@@ -4,58 +4,135 @@
 //--------------------------------------------------------------------------------
 // Interpreter
 #include "Constants.h"
+#include "Interpreter/Engine/BlockEngine.h"
+#include "Interpreter/Engine/ClosureEngine.h"
+#include "Interpreter/Engine/ThreadedEngine.h"
+#include "Interpreter/Instruction/CosmacVipTiming.h"
 #include "Interpreter/Instruction/OpcodeTable.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
 #include "Interpreter/Snapshot/SnapshotBuilder.h"
 
 // System
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
 #include <vector>
 
 //--------------------------------------------------------------------------------
-Interpreter::Interpreter(IRandomProvider& randomProvider)
-	: mCPU(mBus, randomProvider)
-	, mCycleCount(0)
+template <typename Geometry, RandomSource TRandom>
+BasicInterpreter<Geometry, TRandom>::BasicInterpreter(TRandom& randomSource)
+	: mCPU(mBus, randomSource)
 {
 	bool success = mBus.mRAM.WriteRange(0x000, CHAR_SET);
+	success = success && mBus.mRAM.WriteRange(BIG_CHAR_SET_ADDRESS, BIG_CHAR_SET);
 	assert(success && "Failed to load fontset into RAM");
 	
 	mBus.mDisplay.SetRAM(mBus.mRAM);
+	mBus.mRAM.AddWriteListener(mInstructionCache);
+	mBus.mRAM.AddWriteListener(mBlockCache);
+	mBus.mRAM.AddWriteListener(mClosureCache);
+	BindPolicy();
 }
 
 //--------------------------------------------------------------------------------
-void Interpreter::Reset()
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::Reset()
 {
 	mCPU.Reset();
-	mBus.mDisplay.Clear();
-	mCycleCount = 0;	
+	mBus.mDisplay.Reset();
+	mBus.mSoundTimer.Reset();
+	mClock.Reset();
+	mIdleCyclesSkipped = 0;
+	mIsWaitingOnKey = false;
+	mCycleDebt = 0;
 }
 
 //--------------------------------------------------------------------------------
-bool Interpreter::LoadRom(const std::vector<uint8_t>& data)
+template <typename Geometry, RandomSource TRandom>
+bool BasicInterpreter<Geometry, TRandom>::LoadRom(const std::vector<uint8_t>& data, QuirkProfile quirkProfile, InstructionSet instructionSet)
 {
-	// Clear program memory only (preserve fontset in lower RAM)
+	SetQuirkProfile(quirkProfile);
+	mCPU.SetInstructionSet(instructionSet);
+
+	// Clear program memory only (preserve fontset in lower RAM). This also drops
+	// everything decoded with the previous instruction set.
 	mBus.mRAM.ClearProgramMemory();
+	mIsWaitingOnKey = false;
 
 	if (!mBus.mRAM.WriteRange(PROGRAM_START_ADDRESS, data))
 	{
 		std::cerr << "ROM too large to fit into memory." << std::endl;
 		return false;
 	}
-	
+
+	mControlFlowGraph = BasicControlFlowGraph<Geometry>::Analyze(data, instructionSet);
 	return true;
 }
 
 //--------------------------------------------------------------------------------
-Snapshot Interpreter::PeekNextInstruction() const 
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::SetQuirkProfile(QuirkProfile quirkProfile)
+{
+	if (quirkProfile == mCPU.GetQuirkProfile())
+	{
+		return;
+	}
+
+	mCPU.SetQuirkProfile(quirkProfile);
+	BindPolicy();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::SetExecutionMode(ExecutionMode mode)
+{
+	if (mode == mCPU.GetExecutionMode())
+	{
+		return;
+	}
+
+	mCPU.SetExecutionMode(mode);
+	BindPolicy();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::SetTimingMode(TimingMode mode)
+{
+	mTimingMode = mode;
+	mCycleDebt = 0;
+	mClock.SetFrequencyHz(mode == TimingMode::kCosmacVip ? CosmacVipTiming::kMachineCycleHz : MachineClock::kDefaultFrequencyHz);
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::BindPolicy()
+{
+	mRunEngine = VisitQuirkPolicy(mCPU.GetQuirkProfile(), mCPU.GetExecutionMode(), [] <QuirkPolicy Quirks> ()
+	{
+		return &BasicInterpreter::RunEngine<Quirks>;
+	});
+
+	// Translated blocks, closures and native code are bound to the previous policy's handlers
+	mBlockCache.Clear();
+	mClosureCache.Clear();
+	mJitCompiler.Reset();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+Snapshot BasicInterpreter<Geometry, TRandom>::PeekNextInstruction() const 
 { 
-	SnapshotBuilder builder(mCPU, mCycleCount);
+	const FetchResult fetch = mCPU.Peek();
+	const Instruction instruction = fetch.mIsValidAddress ? mCPU.Decode(fetch.mOpcode) : Instruction();
+	SnapshotBuilder builder(mCPU.GetState(), fetch.mOpcode, instruction, mBus.mRAM.View(0, Geometry::kRamSize), mClock.GetCycles());
 	return builder.Build();
 }
 
 //--------------------------------------------------------------------------------
-StepResult Interpreter::Step()
+template <typename Geometry, RandomSource TRandom>
+StepResult BasicInterpreter<Geometry, TRandom>::Step()
 {
 	/*
 		Performs one fetch-decode-execute step.
@@ -68,21 +145,20 @@ StepResult Interpreter::Step()
 	const bool kHaltOnFailure = true;
 	const uint16_t pcBeforeFetch = mCPU.GetProgramCounter();
 
-	// Fetch (increments PC)
-	const FetchResult fetch = mCPU.Fetch();
-	if (!fetch.mIsValidAddress)
+	// Fetch and decode, unless the instruction at PC is already cached
+	Instruction instruction;
+	const ExecutionStatus fetchStatus = FetchDecoded(instruction);
+	if (fetchStatus != ExecutionStatus::Executed)
 	{
-		return { fetch.mStatus, kHaltOnFailure };
+		// Fetch or decode failed; PC has not moved, so CPU state is preserved.
+		return { fetchStatus, kHaltOnFailure };
 	}
 
-	// Decode
-	const Instruction instruction = mCPU.Decode(fetch.mOpcode);
-	if (!instruction.IsValid())
-	{
-		// Decode failed, so we roll back to preserve CPU state.
-		mCPU.SetProgramCounter(pcBeforeFetch);
-		return { ExecutionStatus::DecodeError, kHaltOnFailure };
-	}
+	// Advance PC past the fetched instruction
+	mCPU.SetProgramCounter(pcBeforeFetch + INSTRUCTION_SIZE);
+
+	// Priced before execution, as the cost of Dxyn depends on Vx
+	const uint64_t cycleCost = (mTimingMode == TimingMode::kCosmacVip) ? CosmacVipTiming::GetCycleCost(instruction, mCPU.GetState()) : 1;
 
 	// Execute
 	const ExecutionStatus status = mCPU.Execute(instruction);
@@ -97,11 +173,11 @@ StepResult Interpreter::Step()
 	switch (status)
 	{		
 		case ExecutionStatus::WaitingOnKeyPress:
-			mCycleCount++;
+			mClock.Advance(cycleCost);
 			return { status, !kHaltOnFailure };			
 		
 		case ExecutionStatus::Executed:
-			mCycleCount++;
+			mClock.Advance(cycleCost);
 			return { status, !kHaltOnFailure };	
 		
 		default:
@@ -110,7 +186,425 @@ StepResult Interpreter::Step()
 }
 
 //--------------------------------------------------------------------------------
-void Interpreter::DecrementTimers()
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::DecrementTimers()
 {
 	mCPU.DecrementTimers();
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::RunCycles(size_t cycleBudget, const StopConditions& stopConditions)
+{
+	/*
+		Runs up to cycleBudget clock cycles, which are instructions unless COSMAC
+		VIP timing is on. Stops early if an instruction halts or defers (Fx0A
+		waiting on a key), leaving PC on it, or when one of the stop conditions
+		is met.
+
+		Stop conditions are checked after every instruction, so runs that set any
+		go through Step regardless of the selected engine.
+
+		A run that stops on Fx0A blocks the interpreter until the keypad reports a
+		release edge. Until then runs return straight away with no cycles executed,
+		rather than fetching and executing the wait again every cycle.
+	*/
+
+	RunResult result;
+	if (IsWaitingOnKey())
+	{
+		result.mStatus = ExecutionStatus::WaitingOnKeyPress;
+	}
+	else if (!stopConditions.IsEmpty())
+	{
+		result = RunWithStopConditions(cycleBudget, stopConditions);
+	}
+	else if (mTimingMode == TimingMode::kCosmacVip)
+	{
+		result = RunTimed(cycleBudget);
+	}
+	else if (mIdleLoopSkipping && MayEnterIdleLoop())
+	{
+		result = RunIdleLoopProbe(cycleBudget);
+		if (result.mStatus == ExecutionStatus::Executed && result.mCyclesExecuted < cycleBudget)
+		{
+			const size_t probeCycles = result.mCyclesExecuted;
+			result = (this->*mRunEngine)(cycleBudget - probeCycles);
+			result.mCyclesExecuted += probeCycles;
+		}
+	}
+	else
+	{
+		result = (this->*mRunEngine)(cycleBudget);
+	}
+
+	UpdateKeyWait(result);
+
+	if (result.mShouldHalt)
+	{
+		result.mStopReason = StopReason::kHalted;
+	}
+	else if (result.mStatus == ExecutionStatus::WaitingOnKeyPress)
+	{
+		result.mStopReason = StopReason::kWaitingOnKeyPress;
+	}
+
+	return result;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+void BasicInterpreter<Geometry, TRandom>::UpdateKeyWait(const RunResult& result)
+{
+	mIsWaitingOnKey = (result.mStatus == ExecutionStatus::WaitingOnKeyPress);
+	mKeyWaitReleaseCount = mBus.mKeypad.GetReleaseCount();
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+template <QuirkPolicy Quirks>
+RunResult BasicInterpreter<Geometry, TRandom>::RunEngine(size_t cycleBudget)
+{
+	switch (mExecutionEngine)
+	{
+		case ExecutionEngine::kThreaded:
+		{
+			const RunResult result = ThreadedEngine::Run<Quirks>(*this, cycleBudget);
+			mClock.Advance(result.mCyclesExecuted);
+			return result;
+		}
+
+		case ExecutionEngine::kBlock:
+		case ExecutionEngine::kJit:
+		{
+			const bool useJit = (mExecutionEngine == ExecutionEngine::kJit);
+			const RunResult result = BlockEngine::Run<Quirks>(*this, cycleBudget, useJit);
+			mClock.Advance(result.mCyclesExecuted);
+			return result;
+		}
+
+		case ExecutionEngine::kClosure:
+		{
+			const RunResult result = ClosureEngine::Run<Quirks>(*this, cycleBudget);
+			mClock.Advance(result.mCyclesExecuted);
+			return result;
+		}
+
+		case ExecutionEngine::kSwitch:
+		default:
+			return RunSwitchEngine(cycleBudget);
+	}
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+ExecutionStatus BasicInterpreter<Geometry, TRandom>::FetchDecodedUncached(Instruction& instruction)
+{
+	const FetchResult fetch = mCPU.Peek();
+	if (!fetch.mIsValidAddress)
+	{
+		return fetch.mStatus;
+	}
+
+	instruction = mCPU.Decode(fetch.mOpcode);
+	if (!instruction.IsValid())
+	{
+		return ExecutionStatus::DecodeError;
+	}
+
+	const uint16_t address = mCPU.GetProgramCounter();
+	mInstructionCache.Store(address, instruction);
+	mSequentialFetchAddress = CPUType::GetSequentialAddress(address);
+	return ExecutionStatus::Executed;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::RunSwitchEngine(size_t cycleBudget)
+{
+	RunResult result;
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const StepResult step = Step();
+
+		if (step.mStatus == ExecutionStatus::Executed || step.mStatus == ExecutionStatus::WaitingOnKeyPress)
+		{
+			result.mCyclesExecuted++;
+		}
+
+		if (step.mStatus != ExecutionStatus::Executed)
+		{
+			result.mStatus = step.mStatus;
+			result.mShouldHalt = step.mShouldHalt;
+			break;
+		}
+	}
+
+	return result;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::RunTimed(size_t cycleBudget)
+{
+	RunResult result;
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const RunResult step = StepTimed(cycleBudget - result.mCyclesExecuted);
+		result.mCyclesExecuted += step.mCyclesExecuted;
+
+		if (step.mStatus != ExecutionStatus::Executed)
+		{
+			result.mStatus = step.mStatus;
+			result.mShouldHalt = step.mShouldHalt;
+			break;
+		}
+	}
+
+	return result;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::StepTimed(size_t cycleBudget)
+{
+	/*
+		Runs one instruction against a budget of clock cycles. An instruction may
+		cost more than the budget has left; it still runs, and the excess is paid
+		out of the following budgets before anything else executes. Budgets are
+		therefore never overspent and the rate over time matches the clock.
+	*/
+
+	RunResult result;
+	if (mCycleDebt >= cycleBudget)
+	{
+		mCycleDebt -= cycleBudget;
+		result.mCyclesExecuted = cycleBudget;
+		return result;
+	}
+
+	const uint64_t cyclesBefore = mClock.GetCycles();
+	const StepResult step = Step();
+	const size_t cost = mCycleDebt + static_cast<size_t>(mClock.GetCycles() - cyclesBefore);
+
+	result.mCyclesExecuted = std::min(cost, cycleBudget);
+	result.mStatus = step.mStatus;
+	result.mShouldHalt = step.mShouldHalt;
+	mCycleDebt = cost - result.mCyclesExecuted;
+	return result;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+bool BasicInterpreter<Geometry, TRandom>::MayEnterIdleLoop()
+{
+	/*
+		Walks the code ahead of PC without executing it and reports whether the
+		probe could find an idle loop there: a loop needs a backward jump (or a
+		return or Bnnn, whose targets are unknown here) within kIdleProbeLength
+		instructions, with no side effects on the way. Only the path is followed,
+		not the data, so both outcomes of a skip are allowed for: an instruction
+		that may be skipped does not end the walk, and if it is a jump the walk
+		gives up and lets the probe decide.
+
+		Straight-line code such as a game's main loop body then costs a few cache
+		lookups per run instead of up to kIdleProbeLength Step calls.
+	*/
+
+	uint16_t address = mCPU.GetProgramCounter();
+	bool mayBeSkipped = false;
+
+	for (size_t i = 0; i < kIdleProbeLength; ++i)
+	{
+		const Instruction instruction = PeekDecoded(address);
+		if (!instruction.IsValid())
+		{
+			return false;
+		}
+
+		if (HasSideEffects(instruction.GetOpcodeId()) && !mayBeSkipped)
+		{
+			return false;
+		}
+
+		const ControlFlow controlFlow = GetControlFlow(instruction.GetOpcodeId());
+		switch (controlFlow)
+		{
+			case ControlFlow::kJump:
+			case ControlFlow::kCall:
+			{
+				const uint16_t target = instruction.GetOperandNNN();
+				if (target <= address || mayBeSkipped)
+				{
+					return true;
+				}
+				address = target;
+				break;
+			}
+
+			case ControlFlow::kReturn:
+			case ControlFlow::kIndirectJump:
+				return true;
+
+			case ControlFlow::kExit:
+				if (!mayBeSkipped)
+				{
+					return false;
+				}
+				address = static_cast<uint16_t>(address + INSTRUCTION_SIZE);
+				break;
+
+			case ControlFlow::kLongLoad:
+				address = static_cast<uint16_t>(address + GetInstructionLength(instruction.GetOpcodeId()));
+				break;
+
+			default:
+				address = static_cast<uint16_t>(address + INSTRUCTION_SIZE);
+				break;
+		}
+
+		mayBeSkipped = (controlFlow == ControlFlow::kSkip);
+	}
+
+	return false;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+Instruction BasicInterpreter<Geometry, TRandom>::PeekDecoded(uint16_t address)
+{
+	// Look-ahead rather than a fetch, so the cache's hit and miss counters are
+	// left alone. Misses are decoded and stored for the fetch that follows.
+	if (!CPUType::IsFetchable(address))
+	{
+		return { };
+	}
+
+	Instruction instruction = mInstructionCache.Peek(address);
+	if (!instruction.IsValid())
+	{
+		const uint16_t opcode = static_cast<uint16_t>((mBus.mRAM.Read(address) << 8) | mBus.mRAM.Read(static_cast<uint16_t>(address + 1)));
+		instruction = mCPU.Decode(opcode);
+		if (instruction.IsValid())
+		{
+			mInstructionCache.Store(address, instruction);
+		}
+	}
+
+	return instruction;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::RunIdleLoopProbe(size_t cycleBudget)
+{
+	/*
+		Steps through up to kIdleProbeLength side-effect-free instructions. If the CPU
+		returns to exactly the state it had after the first one, it is in a cycle
+		that can only be broken by the timers or keypad, and neither changes during
+		a run. Whole turns of the cycle are then skipped, up to the next timer tick
+		at most; the rest is left to the engine so the run ends in the same state
+		as executing it all.
+		The first instruction is kept out of the comparison so a poll loop whose
+		load has not yet seen the current timer value is still recognised.
+	*/
+
+	typename CPUType::StateType anchorState;
+	RunResult result;
+
+	while (result.mCyclesExecuted < std::min(cycleBudget, kIdleProbeLength))
+	{
+		const Instruction instruction = PeekDecoded(mCPU.GetProgramCounter());
+		if (!instruction.IsValid() || HasSideEffects(instruction.GetOpcodeId()))
+		{
+			// Not an idle loop; faults are reported by the engine
+			return result;
+		}
+
+		const StepResult step = Step();
+		result.mCyclesExecuted++;
+		if (step.mStatus != ExecutionStatus::Executed)
+		{
+			result.mStatus = step.mStatus;
+			result.mShouldHalt = step.mShouldHalt;
+			return result;
+		}
+
+		if (result.mCyclesExecuted == 1)
+		{
+			anchorState = mCPU.GetState();
+		}
+		else if (mCPU.GetState() == anchorState)
+		{
+			// Skipping stops at the next timer tick: the tick may change what the
+			// loop reads, and a caller whose budget spans it still sees it run
+			const uint64_t now = mClock.GetCycles();
+			const uint64_t nextTick = mClock.GetTickCycle(mClock.CountTicks(now, kTimerFrequencyHz) + 1, kTimerFrequencyHz);
+			const size_t loopLength = result.mCyclesExecuted - 1;
+			const size_t remaining = std::min(cycleBudget - result.mCyclesExecuted, static_cast<size_t>(nextTick - now));
+			const size_t skipped = remaining - remaining % loopLength;
+
+			result.mCyclesExecuted += skipped;
+			mClock.Advance(skipped);
+			mIdleCyclesSkipped += skipped;
+			return result;
+		}
+	}
+
+	return result;
+}
+
+//--------------------------------------------------------------------------------
+template <typename Geometry, RandomSource TRandom>
+RunResult BasicInterpreter<Geometry, TRandom>::RunWithStopConditions(size_t cycleBudget, const StopConditions& stopConditions)
+{
+	RunResult result;
+
+	// Timed instructions can step over the stop cycle, so stop at the first
+	// instruction boundary at or past it, unless the run started there already.
+	const bool isStopCycleAhead = stopConditions.mStopAtCycle && mClock.GetCycles() < *stopConditions.mStopAtCycle;
+
+	while (result.mCyclesExecuted < cycleBudget)
+	{
+		const uint16_t pc = mCPU.GetProgramCounter();
+		const bool isBreakpoint = std::find(stopConditions.mBreakpoints.begin(), stopConditions.mBreakpoints.end(), pc) != stopConditions.mBreakpoints.end();
+		if (isBreakpoint && result.mCyclesExecuted > 0)
+		{
+			result.mStopReason = StopReason::kBreakpoint;
+			break;
+		}
+
+		if (isStopCycleAhead && mClock.GetCycles() >= *stopConditions.mStopAtCycle)
+		{
+			result.mStopReason = StopReason::kCycleReached;
+			break;
+		}
+
+		const uint64_t displayRevision = mBus.mDisplay.GetRevision();
+		const RunResult step = (mTimingMode == TimingMode::kCosmacVip) ? StepTimed(cycleBudget - result.mCyclesExecuted) : RunSwitchEngine(1);
+		result.mCyclesExecuted += step.mCyclesExecuted;
+		result.mStatus = step.mStatus;
+		result.mShouldHalt = step.mShouldHalt;
+
+		if (step.mStatus != ExecutionStatus::Executed)
+		{
+			break;
+		}
+
+		if (stopConditions.mStopOnDisplayChange && mBus.mDisplay.GetRevision() != displayRevision)
+		{
+			result.mStopReason = StopReason::kDisplayChanged;
+			break;
+		}
+	}
+
+	return result;
+}
+
+// Explicit instantiations - one interpreter per machine
+//--------------------------------------------------------------------------------
+#define INSTANTIATE_INTERPRETER(Geometry, TRandom) template class BasicInterpreter<Geometry, TRandom>;
+MACHINE_LIST(INSTANTIATE_INTERPRETER)
+#undef INSTANTIATE_INTERPRETER
\ No newline at end of file
@@ -3,41 +3,172 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Interpreter
-#include "Interfaces/IRandomProvider.h"
 #include "Constants.h"
+#include "Interpreter/Analysis/ControlFlowGraph.h"
 #include "Interpreter/Bus.h"
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Engine/ClosureCache.h"
 #include "Interpreter/Hardware/CPU.h"
+#include "Interpreter/Hardware/MachineClock.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/ExecutionMode.h"
+#include "Types/InstructionSet.h"
+#include "Types/QuirkProfile.h"
+#include "Types/RunResult.h"
+#include "Types/StopConditions.h"
 #include "Types/StepResult.h"
+#include "Types/TimingMode.h"
 #include "Interpreter/Instruction/Instruction.h"
+#include "Interpreter/Instruction/InstructionCache.h"
+#include "Interpreter/Jit/JitCompiler.h"
 #include "Interpreter/Snapshot/Snapshot.h"
 
 // System
 #include <vector>
 #include <memory>
 
+// One machine: the CPU, its bus and the engines that run it, all built for one
+// configuration (see MachineGeometry). TRandom is the random source Cxkk calls
+// (see MACHINE_LIST); it must outlive the interpreter.
 //--------------------------------------------------------------------------------
-class Interpreter
+template <typename Geometry, RandomSource TRandom>
+class BasicInterpreter
 {
 #ifdef UNIT_TESTING
 	friend class OpcodeTest;
 #endif
+	friend class AotRuntime;
+	friend class BlockEngine;
+	friend class ClosureEngine;
+	friend class ThreadedEngine;
 
 public:
-	Interpreter(IRandomProvider& randomProvider);
+	using GeometryType = Geometry;
+	using CPUType = BasicCPU<Geometry, TRandom>;
+	using BusType = typename CPUType::BusType;
+
+	explicit BasicInterpreter(TRandom& randomSource);
 
 	void Reset();
-	bool LoadRom(const std::vector<uint8_t>& data);
+	// The instruction set is fixed for the ROM's lifetime: it selects the decode
+	// table every engine and the analysis read through.
+	bool LoadRom(const std::vector<uint8_t>& data, QuirkProfile quirkProfile = QuirkProfile::kModern,
+		InstructionSet instructionSet = InstructionSet::kChip8);
+	InstructionSet GetInstructionSet() const { return mCPU.GetInstructionSet(); }
 
 	Snapshot PeekNextInstruction() const;	
 	StepResult Step();
+	RunResult RunCycles(size_t cycleBudget, const StopConditions& stopConditions = { });
 	void DecrementTimers();
 
-	const CPU& GetCPU() const { return mCPU; }
-	const Bus& GetBus() const { return mBus; }
-	Bus& GetBus() { return mBus; }
+	// Lets emulated time pass without executing anything, e.g. while blocked on
+	// a key wait.
+	void AdvanceClock(uint64_t cycles) { mClock.Advance(cycles); }
+
+	void SetExecutionEngine(ExecutionEngine engine) { mExecutionEngine = engine; }
+	ExecutionEngine GetExecutionEngine() const { return mExecutionEngine; }
+
+	// Selects the handler instantiations for a quirk profile (also done by LoadRom).
+	void SetQuirkProfile(QuirkProfile quirkProfile);
+	QuirkProfile GetQuirkProfile() const { return mCPU.GetQuirkProfile(); }
+
+	// Checked mode validates every memory and stack access and reports faults such
+	// as StackOverflow (for debugging); unchecked mode masks addresses instead.
+	void SetExecutionMode(ExecutionMode mode);
+	ExecutionMode GetExecutionMode() const { return mCPU.GetExecutionMode(); }
+
+	// COSMAC VIP timing runs the clock at the VIP's machine cycle rate and charges
+	// each instruction its VIP cost, so cycle budgets buy the VIP's speed rather
+	// than a fixed instruction count. Runs in this mode step through the switch
+	// engine. Changing the mode converts the clock to the new rate without
+	// losing emulated time (see MachineClock::SetFrequencyHz).
+	void SetTimingMode(TimingMode mode);
+	TimingMode GetTimingMode() const { return mTimingMode; }
+
+	// When enabled, a run that finds the program spinning in a side-effect-free
+	// loop skips ahead to the next 60 Hz timer tick or the end of its budget,
+	// whichever comes first. Skipped cycles still count as executed.
+	void SetIdleLoopSkipping(bool enabled) { mIdleLoopSkipping = enabled; }
+	uint64_t GetIdleCyclesSkipped() const { return mIdleCyclesSkipped; }
+
+	// True while a run has stopped on Fx0A and no key has been released since.
+	// Runs in this state return WaitingOnKeyPress at once without executing
+	// anything; timers keep ticking through DecrementTimers.
+	bool IsWaitingOnKey() const { return mIsWaitingOnKey && mBus.mKeypad.GetReleaseCount() == mKeyWaitReleaseCount; }
+
+	const MachineClock& GetClock() const { return mClock; }
+	const CPUType& GetCPU() const { return mCPU; }
+	const BusType& GetBus() const { return mBus; }
+	BusType& GetBus() { return mBus; }
+	const BasicInstructionCache<Geometry>& GetInstructionCache() const { return mInstructionCache; }
+	const BasicBlockCache<CPUType>& GetBlockCache() const { return mBlockCache; }
+	const BasicControlFlowGraph<Geometry>& GetControlFlowGraph() const { return mControlFlowGraph; } // Of the loaded ROM
+	const BasicClosureCache<CPUType>& GetClosureCache() const { return mClosureCache; }
+	const JitCompiler& GetJitCompiler() const { return mJitCompiler; }
 
 private:
-	Bus mBus;
-	CPU mCPU;
-	size_t mCycleCount;
-};
\ No newline at end of file
+	static constexpr size_t kIdleProbeLength = 16; // Longest idle loop looked for, in instructions
+	static constexpr uint32_t kTimerFrequencyHz = static_cast<uint32_t>(SYSTEM_TIMER_HZ); // Idle skips never cross a tick
+
+	// Fetches and decodes the instruction at PC without moving PC. Returns Executed
+	// on success, otherwise the fetch or decode failure status.
+	//
+	// PC is only validated in full when it is not 2 past the last fetch, i.e. after
+	// a jump, call, return, skip or Bnnn. A sequential PC goes straight to the cache,
+	// whose only possible failure (running off the end of RAM) is a miss, and misses
+	// take the fully validated path.
+	ExecutionStatus FetchDecoded(Instruction& instruction)
+	{
+		const uint16_t address = mCPU.GetProgramCounter();
+		if (address == mSequentialFetchAddress || CPUType::IsFetchable(address))
+		{
+			instruction = mInstructionCache.Lookup(address);
+			if (instruction.IsValid())
+			{
+				mSequentialFetchAddress = CPUType::GetSequentialAddress(address);
+				return ExecutionStatus::Executed;
+			}
+		}
+		return FetchDecodedUncached(instruction);
+	}
+
+	ExecutionStatus FetchDecodedUncached(Instruction& instruction);
+	template <QuirkPolicy Quirks>
+	RunResult RunEngine(size_t cycleBudget);
+	RunResult RunSwitchEngine(size_t cycleBudget);
+	RunResult RunTimed(size_t cycleBudget);
+	RunResult StepTimed(size_t cycleBudget);
+	RunResult RunWithStopConditions(size_t cycleBudget, const StopConditions& stopConditions);
+	bool MayEnterIdleLoop();
+	Instruction PeekDecoded(uint16_t address);
+	RunResult RunIdleLoopProbe(size_t cycleBudget);
+	void UpdateKeyWait(const RunResult& result);
+	void BindPolicy();
+
+	// The CPU's hot line and the per-run scalars are kept together, ahead of
+	// the caches and the load-time analysis
+	BusType mBus;
+	CPUType mCPU;
+	RunResult (BasicInterpreter::*mRunEngine)(size_t) = &BasicInterpreter::RunEngine<ModernQuirks>;
+	MachineClock mClock;
+	size_t mCycleDebt = 0; // Cycles of the last timed instruction beyond its run's budget
+	uint64_t mIdleCyclesSkipped = 0;
+	uint64_t mKeyWaitReleaseCount = 0; // Keypad release count when the wait began
+	uint16_t mSequentialFetchAddress = PROGRAM_START_ADDRESS; // Fetchable or kRamSize
+	ExecutionEngine mExecutionEngine = ExecutionEngine::kSwitch;
+	TimingMode mTimingMode = TimingMode::kInstruction;
+	bool mIdleLoopSkipping = false;
+	bool mIsWaitingOnKey = false;
+	BasicInstructionCache<Geometry> mInstructionCache;
+	BasicBlockCache<CPUType> mBlockCache;
+	BasicClosureCache<CPUType> mClosureCache;
+	JitCompiler mJitCompiler;
+	BasicControlFlowGraph<Geometry> mControlFlowGraph;
+};
+
+// One interpreter per configuration, for any IRandomProvider called through its
+// vtable. Interpreter is the CHIP-8 one most code runs.
+using Chip8Interpreter = BasicInterpreter<Chip8Geometry, IRandomProvider>;
+using SuperChipInterpreter = BasicInterpreter<SuperChipGeometry, IRandomProvider>;
+using XoChipInterpreter = BasicInterpreter<XoChipGeometry, IRandomProvider>;
+using Interpreter = Chip8Interpreter;
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "Interpreter/Jit/ExecutableMemory.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <cstring>
+
+#if defined(_WIN32)
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+#endif
+
+//--------------------------------------------------------------------------------
+ExecutableMemory::ExecutableMemory(size_t capacity)
+	: mCapacity(capacity)
+{ }
+
+//--------------------------------------------------------------------------------
+ExecutableMemory::~ExecutableMemory()
+{
+	if (mBase == nullptr)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	VirtualFree(mBase, 0, MEM_RELEASE);
+#else
+	munmap(mBase, mCapacity);
+#endif
+}
+
+//--------------------------------------------------------------------------------
+const void* ExecutableMemory::Append(std::span<const uint8_t> code)
+{
+	if (mBase == nullptr && !Map())
+	{
+		return nullptr;
+	}
+
+	// Keep each function 16-byte aligned
+	const size_t start = (mUsed + 15) & ~static_cast<size_t>(15);
+	if (start + code.size() > mCapacity || !SetWritable(true))
+	{
+		return nullptr;
+	}
+
+	std::memcpy(mBase + start, code.data(), code.size());
+	if (!SetWritable(false))
+	{
+		return nullptr;
+	}
+
+#if defined(_WIN32)
+	FlushInstructionCache(GetCurrentProcess(), mBase + start, code.size());
+#endif
+
+	mUsed = start + code.size();
+	return mBase + start;
+}
+
+//--------------------------------------------------------------------------------
+bool ExecutableMemory::Map()
+{
+	if (mMapFailed)
+	{
+		return false;
+	}
+
+#if defined(_WIN32)
+	void* memory = VirtualAlloc(nullptr, mCapacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	mMapFailed = (memory == nullptr);
+#else
+	void* memory = mmap(nullptr, mCapacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	mMapFailed = (memory == MAP_FAILED);
+#endif
+
+	if (mMapFailed)
+	{
+		return false;
+	}
+
+	mBase = static_cast<uint8_t*>(memory);
+	return true;
+}
+
+//--------------------------------------------------------------------------------
+bool ExecutableMemory::SetWritable(bool writable)
+{
+#if defined(_WIN32)
+	DWORD previous = 0;
+	return VirtualProtect(mBase, mCapacity, writable ? PAGE_READWRITE : PAGE_EXECUTE_READ, &previous) != 0;
+#else
+	return mprotect(mBase, mCapacity, writable ? (PROT_READ | PROT_WRITE) : (PROT_READ | PROT_EXEC)) == 0;
+#endif
+}
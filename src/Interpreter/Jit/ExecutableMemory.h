@@ -0,0 +1,39 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Fixed-size arena for generated code. Pages are mapped lazily on first use and
+// are never writable and executable at the same time: Append() opens the arena
+// for writing, copies the code in and seals it again.
+//--------------------------------------------------------------------------------
+class ExecutableMemory
+{
+public:
+	explicit ExecutableMemory(size_t capacity);
+	~ExecutableMemory();
+
+	ExecutableMemory(const ExecutableMemory&) = delete;
+	ExecutableMemory& operator=(const ExecutableMemory&) = delete;
+
+	// Copies code into the arena. Returns nullptr if it is full or unavailable.
+	[[nodiscard]] const void* Append(std::span<const uint8_t> code);
+
+	// Discards all code. Callers must drop every pointer returned by Append.
+	void Reset() { mUsed = 0; }
+
+	size_t GetUsed() const { return mUsed; }
+
+private:
+	bool Map();
+	bool SetWritable(bool writable);
+
+	uint8_t* mBase = nullptr;
+	size_t mCapacity = 0;
+	size_t mUsed = 0;
+	bool mMapFailed = false;
+};
@@ -0,0 +1,361 @@
+#include "Interpreter/Jit/JitCompiler.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Hardware/CPUState.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+#include "Interpreter/Instruction/OpcodeTraits.h"
+
+// System
+#include <cstddef>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	using Reg = X64Emitter::Reg;
+	using AluOp = X64Emitter::AluOp;
+	using Condition = X64Emitter::Condition;
+
+	constexpr int32_t kProgramCounterOffset = static_cast<int32_t>(offsetof(CPUState, mProgramCounter));
+	constexpr int32_t kDelayTimerOffset = static_cast<int32_t>(offsetof(CPUState, mDelayTimer));
+	constexpr int32_t kSoundTimerOffset = static_cast<int32_t>(offsetof(CPUState, mSoundTimer));
+
+	// Handlers are called directly and only their status (in eax) is inspected
+	static_assert(offsetof(MicroOpResult, mStatus) == 0 && sizeof(MicroOpResult) <= sizeof(uint64_t));
+	static_assert(static_cast<int>(ExecutionStatus::Executed) == 0);
+
+	// Budget adjustments are signed bytes
+	static_assert(BlockCache::kMaxBlockLength <= 127);
+
+	// Skips whose both outcomes are emitted inline
+	constexpr bool IsInlineSkip(OpcodeId opcodeId)
+	{
+		return opcodeId == OpcodeId::SE_VX_KK || opcodeId == OpcodeId::SNE_VX_KK
+			|| opcodeId == OpcodeId::SE_VX_VY || opcodeId == OpcodeId::SNE_VX_VY;
+	}
+}
+
+//--------------------------------------------------------------------------------
+JitCompiler::JitCompiler()
+	: mMemory(kCodeCapacity)
+	, mRegisters(mEmitter)
+{ }
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TCPU>
+BasicNativeBlockFunction<TCPU> JitCompiler::Compile(const BasicTranslatedBlock<TCPU>& block, uint16_t entry, const TCPU& cpu, const BasicBlockCache<TCPU>& blockCache)
+{
+	/*
+		PC is only stored where it can be observed: before a handler call (which
+		may read it or fail and be rolled back), by inline control flow, and once at
+		the end if the block falls through. V0-VF and I live in host registers
+		between handler calls (see RegisterCache) and are stored at every exit.
+
+		Exits to a successor known here (the fall-through, a 1nnn or 2nnn
+		target, or either side of a skip) chain to it; the rest return to the
+		engine.
+	*/
+
+	// Every stack depth lays out the fields ahead of the stack alike, so the
+	// offsets above and in RegisterCache hold for any machine
+	static_assert(offsetof(typename TCPU::StateType, mStack) == offsetof(CPUState, mStack));
+
+	if (!kIsSupported || mIsFull)
+	{
+		return nullptr;
+	}
+
+	const uint32_t opCount = static_cast<uint32_t>(block.mOps.size());
+
+	mEmitter.Clear();
+	mEmitter.EmitPrologue();
+	mEmitter.EmitEnterBlock(static_cast<uint8_t>(opCount));
+	mRegisters.Reset();
+
+	for (uint32_t i = 0; i < opCount; ++i)
+	{
+		const uint16_t address = static_cast<uint16_t>(entry + i * INSTRUCTION_SIZE);
+		EmitOp<Quirks, TCPU>(block.mOps[i], address, i, opCount, cpu.HasLongInstructions(), blockCache);
+	}
+
+	mRegisters.EmitWriteBack();
+
+	const Instruction& last = block.mOps.back().mInstruction;
+	const OpcodeId lastOpcodeId = last.GetOpcodeId();
+	const uint16_t lastAddress = static_cast<uint16_t>(entry + (opCount - 1) * INSTRUCTION_SIZE);
+
+	if (!EndsBasicBlock(lastOpcodeId))
+	{
+		if (!WritesMemory(lastOpcodeId))
+		{
+			mEmitter.EmitStoreImm16(kProgramCounterOffset, static_cast<uint16_t>(block.mEndAddress)); // Wraps as PC does
+		}
+		EmitChain(blockCache, block.mEndAddress, 0);
+	}
+	else if (lastOpcodeId == OpcodeId::JP_ADDR || lastOpcodeId == OpcodeId::CALL_ADDR)
+	{
+		EmitChain(blockCache, last.GetOperandNNN(), 0);
+	}
+	else if (IsInlineSkip(lastOpcodeId) && !cpu.HasLongInstructions())
+	{
+		const uint32_t skipAddress = lastAddress + 2u * INSTRUCTION_SIZE;
+		mEmitter.EmitCompareWordImm16(kProgramCounterOffset, static_cast<uint16_t>(skipAddress));
+		const size_t notSkipped = mEmitter.EmitJump(Condition::NotEqual);
+		EmitChain(blockCache, skipAddress, 0);
+		mEmitter.PatchJump(notSkipped);
+		EmitChain(blockCache, lastAddress + INSTRUCTION_SIZE, 0);
+	}
+	else
+	{
+		// Returns, Bnnn and other control flow done by handlers go back to the engine
+		mEmitter.EmitReturnExecuted(0);
+	}
+
+	const void* code = mMemory.Append(mEmitter.GetCode());
+	if (code == nullptr)
+	{
+		mIsFull = true;
+		return nullptr;
+	}
+
+	++mCompiledBlockCount;
+	return reinterpret_cast<BasicNativeBlockFunction<TCPU>>(code);
+}
+
+//--------------------------------------------------------------------------------
+template <typename TCPU>
+void JitCompiler::EmitChain(const BasicBlockCache<TCPU>& blockCache, uint32_t target, uint32_t unretiredOps)
+{
+	const BasicNativeBlockFunction<TCPU>* slot = blockCache.GetNativeCodeSlot(target);
+	if (slot == nullptr)
+	{
+		mEmitter.EmitReturnExecuted(static_cast<uint8_t>(unretiredOps));
+		return;
+	}
+
+	mEmitter.EmitChain(slot, static_cast<uint8_t>(unretiredOps));
+}
+
+//--------------------------------------------------------------------------------
+void JitCompiler::Reset()
+{
+	mMemory.Reset();
+	mIsFull = false;
+}
+
+//--------------------------------------------------------------------------------
+template <QuirkPolicy Quirks, typename TCPU>
+void JitCompiler::EmitOp(const BasicMicroOp<TCPU>& op, uint16_t address, uint32_t opIndex, uint32_t opCount, bool hasLongInstructions,
+	const BasicBlockCache<TCPU>& blockCache)
+{
+	const Instruction& instruction = op.mInstruction;
+	const size_t x = instruction.GetOperandX();
+	const size_t y = instruction.GetOperandY();
+	const uint16_t nextAddress = static_cast<uint16_t>(address + INSTRUCTION_SIZE);
+	const uint16_t skipAddress = static_cast<uint16_t>(address + 2 * INSTRUCTION_SIZE);
+	const bool isLastOp = opIndex + 1 == opCount;
+
+	mRegisters.BeginOp();
+
+	// If the handler fails or defers, PC is rolled back to this op, which is
+	// not retired
+	auto emitHandlerCall = [&]()
+	{
+		mEmitter.EmitStoreImm16(kProgramCounterOffset, nextAddress);
+		mRegisters.Spill();
+		const size_t executed = mEmitter.EmitCallHandler(reinterpret_cast<const void*>(BasicBlockCache<TCPU>::template GetHandler<Quirks>(instruction.GetOpcodeId())), &op);
+		mEmitter.EmitStoreImm16(kProgramCounterOffset, address);
+		mEmitter.EmitReturnStatus(static_cast<uint8_t>(opCount - opIndex));
+		mEmitter.PatchJump(executed);
+	};
+
+	// The instruction a block-ending skip steps over lies outside the block, so
+	// where it may be a four-byte F000 nnnn the handler measures it at run time
+	if (isLastOp && hasLongInstructions && GetControlFlow(instruction.GetOpcodeId()) == ControlFlow::kSkip)
+	{
+		emitHandlerCall();
+		return;
+	}
+
+	// Vx = lhs op rhs with the carry (or not-carry) in VF. The flag is written
+	// after Vx, so VF holds the flag when x is F.
+	auto emitBinaryWithFlag = [&](AluOp aluOp, size_t lhs, size_t rhs, bool flagIsNotCarry)
+	{
+		const Reg lhsReg = mRegisters.Read(lhs);
+		const Reg rhsReg = mRegisters.Read(rhs);
+		const Reg vx = mRegisters.Write(x);
+		mEmitter.EmitMove8(Reg::Rax, lhsReg);
+		mEmitter.EmitAlu8(aluOp, Reg::Rax, rhsReg);
+		if (flagIsNotCarry)
+		{
+			mEmitter.EmitSetNotCarry(Reg::Rcx);
+		}
+		else
+		{
+			mEmitter.EmitSetCarry(Reg::Rcx);
+		}
+		mEmitter.EmitMove8(vx, Reg::Rax);
+		mEmitter.EmitMove8(mRegisters.Write(FLAG_REGISTER_INDEX), Reg::Rcx);
+	};
+
+	// Vx = shift of the source with the bit shifted out in VF, as above
+	auto emitShift = [&](bool isLeft)
+	{
+		const Reg source = mRegisters.Read(Quirks::kShiftReadsVy ? y : x);
+		const Reg vx = mRegisters.Write(x);
+		mEmitter.EmitMove8(Reg::Rax, source);
+		if (isLeft)
+		{
+			mEmitter.EmitShiftLeft1(Reg::Rax);
+		}
+		else
+		{
+			mEmitter.EmitShiftRight1(Reg::Rax);
+		}
+		mEmitter.EmitSetCarry(Reg::Rcx);
+		mEmitter.EmitMove8(vx, Reg::Rax);
+		mEmitter.EmitMove8(mRegisters.Write(FLAG_REGISTER_INDEX), Reg::Rcx);
+	};
+
+	// PC = next; if the condition holds, PC = next + 2. A skip followed by the jump
+	// it guards leaves the block when taken, having retired only itself, and
+	// chains to the instruction after the jump.
+	auto emitSkip = [&](Condition skipUnless)
+	{
+		mEmitter.EmitStoreImm16(kProgramCounterOffset, nextAddress);
+		const size_t noSkip = mEmitter.EmitJump(skipUnless);
+		mEmitter.EmitStoreImm16(kProgramCounterOffset, skipAddress);
+		if (!isLastOp)
+		{
+			mRegisters.EmitWriteBack();
+			EmitChain(blockCache, skipAddress, opCount - (opIndex + 1));
+		}
+		mEmitter.PatchJump(noSkip);
+	};
+
+	switch (instruction.GetOpcodeId())
+	{
+		case OpcodeId::SYS_ADDR:
+			break;
+
+		case OpcodeId::JP_ADDR:
+			mEmitter.EmitStoreImm16(kProgramCounterOffset, instruction.GetOperandNNN());
+			break;
+
+		case OpcodeId::SE_VX_KK:
+			mEmitter.EmitCompareImm8(mRegisters.Read(x), instruction.GetOperandKK());
+			emitSkip(Condition::NotEqual);
+			break;
+
+		case OpcodeId::SNE_VX_KK:
+			mEmitter.EmitCompareImm8(mRegisters.Read(x), instruction.GetOperandKK());
+			emitSkip(Condition::Equal);
+			break;
+
+		case OpcodeId::SE_VX_VY:
+		{
+			const Reg vx = mRegisters.Read(x);
+			mEmitter.EmitAlu8(AluOp::Cmp, vx, mRegisters.Read(y));
+			emitSkip(Condition::NotEqual);
+			break;
+		}
+
+		case OpcodeId::SNE_VX_VY:
+		{
+			const Reg vx = mRegisters.Read(x);
+			mEmitter.EmitAlu8(AluOp::Cmp, vx, mRegisters.Read(y));
+			emitSkip(Condition::Equal);
+			break;
+		}
+
+		case OpcodeId::LD_VX_KK:
+			mEmitter.EmitMoveImm8(mRegisters.Write(x), instruction.GetOperandKK());
+			break;
+
+		case OpcodeId::ADD_VX_KK:
+			mEmitter.EmitAddImm8(mRegisters.Modify(x), instruction.GetOperandKK());
+			break;
+
+		case OpcodeId::LD_VX_VY:
+		{
+			const Reg vy = mRegisters.Read(y);
+			mEmitter.EmitMove8(mRegisters.Write(x), vy);
+			break;
+		}
+
+		case OpcodeId::OR_VX_VY:
+		case OpcodeId::AND_VX_VY:
+		case OpcodeId::XOR_VX_VY:
+		{
+			const AluOp aluOp = instruction.GetOpcodeId() == OpcodeId::OR_VX_VY ? AluOp::Or
+				: instruction.GetOpcodeId() == OpcodeId::AND_VX_VY ? AluOp::And : AluOp::Xor;
+			const Reg vx = mRegisters.Modify(x);
+			mEmitter.EmitAlu8(aluOp, vx, mRegisters.Read(y));
+			if constexpr (Quirks::kLogicResetsFlag)
+			{
+				mEmitter.EmitMoveImm8(mRegisters.Write(FLAG_REGISTER_INDEX), 0);
+			}
+			break;
+		}
+
+		case OpcodeId::ADD_VX_VY:
+			emitBinaryWithFlag(AluOp::Add, x, y, false);
+			break;
+
+		case OpcodeId::SUB_VX_VY:
+			emitBinaryWithFlag(AluOp::Sub, x, y, true);
+			break;
+
+		case OpcodeId::SUBN_VX_VY:
+			emitBinaryWithFlag(AluOp::Sub, y, x, true);
+			break;
+
+		case OpcodeId::SHR_VX_VY:
+			emitShift(false);
+			break;
+
+		case OpcodeId::SHL_VX_VY:
+			emitShift(true);
+			break;
+
+		case OpcodeId::LD_I_ADDR:
+			mEmitter.EmitMoveImmWord(mRegisters.Write(RegisterCache::kIndexSlot), instruction.GetOperandNNN());
+			break;
+
+		case OpcodeId::ADD_I_VX:
+		{
+			const Reg vx = mRegisters.Read(x);
+			mEmitter.EmitAddByteToWord(mRegisters.Modify(RegisterCache::kIndexSlot), vx);
+			break;
+		}
+
+		case OpcodeId::LD_VX_DT:
+			mEmitter.EmitLoad8(mRegisters.Write(x), kDelayTimerOffset);
+			break;
+
+		case OpcodeId::LD_DT_VX:
+			mEmitter.EmitStore8(kDelayTimerOffset, mRegisters.Read(x));
+			break;
+
+		case OpcodeId::LD_ST_VX:
+			mEmitter.EmitStore8(kSoundTimerOffset, mRegisters.Read(x));
+			break;
+
+		default:
+			// Display, keypad, stack, RNG and memory opcodes go through the handler,
+			// which works on CPUState
+			emitHandlerCall();
+			break;
+	}
+}
+
+#define INSTANTIATE_COMPILE(Quirks, Geometry, TRandom) \
+	template BasicNativeBlockFunction<BasicCPU<Geometry, TRandom>> JitCompiler::Compile<Quirks>(const BasicTranslatedBlock<BasicCPU<Geometry, TRandom>>&, uint16_t, const BasicCPU<Geometry, TRandom>&, \
+		const BasicBlockCache<BasicCPU<Geometry, TRandom>>&);
+#define INSTANTIATE_MACHINE(Geometry, TRandom) QUIRK_POLICY_LIST(INSTANTIATE_COMPILE, Geometry, TRandom)
+MACHINE_LIST(INSTANTIATE_MACHINE)
+#undef INSTANTIATE_MACHINE
+#undef INSTANTIATE_COMPILE
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Hardware/Quirks.h"
+#include "Interpreter/Jit/ExecutableMemory.h"
+#include "Interpreter/Jit/RegisterCache.h"
+#include "Interpreter/Jit/X64Emitter.h"
+
+// System
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define JIT_COMPILER_X64 1
+#else
+	#define JIT_COMPILER_X64 0
+#endif
+
+// Compiles hot translated blocks to x86-64. Register, I, timer, jump and skip
+// opcodes are emitted inline, with V0-VF and I held in host registers between
+// handler calls (see RegisterCache); every other opcode calls its
+// plain handler (superinstructions are not used), so behaviour matches
+// CPU::Execute exactly. Quirk-dependent opcodes are emitted for the quirk policy
+// the block was translated with.
+//
+// A compiled block is called with the engine's remaining budget and returns
+// what is left of it in the low 32 bits, with an ExecutionStatus in the high 32.
+// If a handler fails or defers, it returns early with PC on that op, which is
+// not retired.
+//
+// Blocks chain: an exit whose successor is known at compile time (the
+// fall-through, a 1nnn or 2nnn target, or either side of a skip) jumps
+// straight into the successor's native code while the budget covers it. The
+// jump reads the successor's BlockCache slot, so a successor that is not
+// compiled, or whose code was dropped on a RAM write or policy change, returns
+// to the engine instead; nothing is patched in place. Exits whose target is
+// only known at run time (00EE, Bnnn, F000 and skips measured by their
+// handler) always return to the engine, which looks up the next block itself.
+//--------------------------------------------------------------------------------
+class JitCompiler
+{
+public:
+	static constexpr bool kIsSupported = JIT_COMPILER_X64;
+	static constexpr uint32_t kHotBlockThreshold = 16;
+	static constexpr size_t kCodeCapacity = 1024 * 1024;
+	static constexpr uint64_t kBudgetMask = 0xFFFFFFFF;
+	static constexpr uint32_t kStatusShift = 32;
+	static constexpr uint64_t kMaxBudget = kBudgetMask; // Budgets above it are run in parts
+
+	JitCompiler();
+
+	// Returns nullptr if the host is not x86-64 or the code arena is full. The code
+	// calls the handlers of the block's CPU type, TCPU, and is only valid for the
+	// instruction set cpu had when it was compiled. It chains through the slots
+	// of blockCache, which must outlive it.
+	template <QuirkPolicy Quirks, typename TCPU>
+	[[nodiscard]] BasicNativeBlockFunction<TCPU> Compile(const BasicTranslatedBlock<TCPU>& block, uint16_t entry, const TCPU& cpu,
+		const BasicBlockCache<TCPU>& blockCache);
+
+	// Discards all generated code. Callers must drop every compiled function first.
+	void Reset();
+
+	bool IsFull() const { return mIsFull; }
+	uint64_t GetCompiledBlockCount() const { return mCompiledBlockCount; }
+
+private:
+	template <QuirkPolicy Quirks, typename TCPU>
+	void EmitOp(const BasicMicroOp<TCPU>& op, uint16_t address, uint32_t opIndex, uint32_t opCount, bool hasLongInstructions,
+		const BasicBlockCache<TCPU>& blockCache);
+
+	// Chains to the block at target, or returns to the engine if no block can start there
+	template <typename TCPU>
+	void EmitChain(const BasicBlockCache<TCPU>& blockCache, uint32_t target, uint32_t unretiredOps);
+
+	ExecutableMemory mMemory;
+	X64Emitter mEmitter;
+	RegisterCache mRegisters;
+	uint64_t mCompiledBlockCount = 0;
+	bool mIsFull = false;
+};
@@ -0,0 +1,125 @@
+#include "Interpreter/Jit/RegisterCache.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/CPUState.h"
+
+// System
+#include <cassert>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	constexpr int32_t SlotOffset(size_t slot)
+	{
+		return (slot == RegisterCache::kIndexSlot)
+			? static_cast<int32_t>(offsetof(CPUState, mIndexRegister))
+			: static_cast<int32_t>(offsetof(CPUState, mRegisters) + slot);
+	}
+}
+
+//--------------------------------------------------------------------------------
+RegisterCache::RegisterCache(X64Emitter& emitter)
+	: mEmitter(emitter)
+{ }
+
+//--------------------------------------------------------------------------------
+void RegisterCache::Reset()
+{
+	mEntries.fill({ });
+	mOpStamp = 0;
+}
+
+//--------------------------------------------------------------------------------
+void RegisterCache::EmitWriteBack() const
+{
+	for (size_t i = 0; i < mEntries.size(); ++i)
+	{
+		if (mEntries[i].mSlot && mEntries[i].mIsDirty)
+		{
+			EmitStore(mEntries[i], X64Emitter::kCacheRegisters[i]);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------
+void RegisterCache::Spill()
+{
+	EmitWriteBack();
+	mEntries.fill({ });
+}
+
+//--------------------------------------------------------------------------------
+RegisterCache::Reg RegisterCache::Acquire(size_t slot, bool isLoaded, bool isWritten)
+{
+	assert(slot <= kIndexSlot);
+
+	size_t chosen = mEntries.size();
+	for (size_t i = 0; i < mEntries.size(); ++i)
+	{
+		if (mEntries[i].mSlot == slot)
+		{
+			chosen = i;
+			break;
+		}
+	}
+
+	if (chosen == mEntries.size())
+	{
+		// A free register, else the least recently used one not in this op
+		for (size_t i = 0; i < mEntries.size(); ++i)
+		{
+			const Entry& entry = mEntries[i];
+			if (entry.mLastUse == mOpStamp && entry.mSlot)
+			{
+				continue;
+			}
+			if (chosen == mEntries.size() || !entry.mSlot
+				|| (mEntries[chosen].mSlot && entry.mLastUse < mEntries[chosen].mLastUse))
+			{
+				chosen = i;
+			}
+		}
+		assert(chosen < mEntries.size() && "An op uses more registers than the cache holds");
+
+		Entry& entry = mEntries[chosen];
+		if (entry.mSlot && entry.mIsDirty)
+		{
+			EmitStore(entry, X64Emitter::kCacheRegisters[chosen]);
+		}
+
+		entry = { slot, false, 0 };
+		if (isLoaded)
+		{
+			const Reg reg = X64Emitter::kCacheRegisters[chosen];
+			if (slot == kIndexSlot)
+			{
+				mEmitter.EmitLoadWord(reg, SlotOffset(slot));
+			}
+			else
+			{
+				mEmitter.EmitLoad8(reg, SlotOffset(slot));
+			}
+		}
+	}
+
+	Entry& entry = mEntries[chosen];
+	entry.mLastUse = mOpStamp;
+	entry.mIsDirty = entry.mIsDirty || isWritten;
+	return X64Emitter::kCacheRegisters[chosen];
+}
+
+//--------------------------------------------------------------------------------
+void RegisterCache::EmitStore(const Entry& entry, Reg reg) const
+{
+	if (*entry.mSlot == kIndexSlot)
+	{
+		mEmitter.EmitStoreWord(SlotOffset(*entry.mSlot), reg);
+	}
+	else
+	{
+		mEmitter.EmitStore8(SlotOffset(*entry.mSlot), reg);
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Jit/X64Emitter.h"
+
+// System
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// Holds guest registers (V0-VF and I) in host registers while a block is
+// compiled. A guest register is loaded on first use and stored back only if it
+// was written, at block exits and before handler calls (which read and write
+// CPUState directly and clobber the cache registers). When every cache register
+// is taken, the least recently used one is written back and reused.
+//
+// Compiled blocks are straight-line code whose only branches are forward side
+// exits, so the state tracked here describes the generated code exactly at the
+// point it is emitted.
+//--------------------------------------------------------------------------------
+class RegisterCache
+{
+public:
+	using Reg = X64Emitter::Reg;
+
+	static constexpr size_t kIndexSlot = REGISTER_COUNT; // I, after V0-VF
+
+	explicit RegisterCache(X64Emitter& emitter);
+
+	// Forgets every cached register, e.g. at the start of a block
+	void Reset();
+
+	// Starts the next guest op. Registers used by the current op are never
+	// evicted, so an op can hold all of its operands at once.
+	void BeginOp() { ++mOpStamp; }
+
+	// The host register holding the slot: Read loads it, Write does not (the op
+	// overwrites it whole) and Modify does both. Write and Modify mark it dirty.
+	[[nodiscard]] Reg Read(size_t slot) { return Acquire(slot, true, false); }
+	[[nodiscard]] Reg Write(size_t slot) { return Acquire(slot, false, true); }
+	[[nodiscard]] Reg Modify(size_t slot) { return Acquire(slot, true, true); }
+
+	// Stores dirty registers for a side exit. The code that continues past the
+	// exit still has them cached, so nothing is forgotten.
+	void EmitWriteBack() const;
+
+	// Stores dirty registers and forgets all, before a handler call
+	void Spill();
+
+private:
+	struct Entry
+	{
+		std::optional<size_t> mSlot;
+		bool mIsDirty = false;
+		uint64_t mLastUse = 0;
+	};
+
+	Reg Acquire(size_t slot, bool isLoaded, bool isWritten);
+	void EmitStore(const Entry& entry, Reg reg) const;
+
+	X64Emitter& mEmitter;
+	std::array<Entry, X64Emitter::kCacheRegisters.size()> mEntries;
+	uint64_t mOpStamp = 0;
+};
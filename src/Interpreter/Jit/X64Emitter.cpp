@@ -0,0 +1,370 @@
+#include "Interpreter/Jit/X64Emitter.h"
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <cassert>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+#if defined(_WIN32)
+	// Win64: arguments in rcx, rdx, r8; 32 bytes of shadow space for callees
+	constexpr uint8_t kFrameSize = 32;
+	constexpr uint8_t kMoveBasesFromArguments[] = { 0x48, 0x89, 0xCD, 0x48, 0x89, 0xD3 }; // mov rbp, rcx; mov rbx, rdx
+	constexpr uint8_t kMoveBudgetFromArgument[] = { 0x4D, 0x89, 0xC4 };                   // mov r12, r8
+	constexpr uint8_t kMoveCpuToFirstArgument[] = { 0x48, 0x89, 0xE9 };                   // mov rcx, rbp
+	constexpr uint8_t kMoveImm64ToSecondArgument[] = { 0x48, 0xBA };                      // mov rdx, imm64
+#else
+	// System V: arguments in rdi, rsi, rdx; the three pushes keep rsp 16-byte
+	// aligned at calls
+	constexpr uint8_t kFrameSize = 0;
+	constexpr uint8_t kMoveBasesFromArguments[] = { 0x48, 0x89, 0xFD, 0x48, 0x89, 0xF3 }; // mov rbp, rdi; mov rbx, rsi
+	constexpr uint8_t kMoveBudgetFromArgument[] = { 0x49, 0x89, 0xD4 };                   // mov r12, rdx
+	constexpr uint8_t kMoveCpuToFirstArgument[] = { 0x48, 0x89, 0xEF };                   // mov rdi, rbp
+	constexpr uint8_t kMoveImm64ToSecondArgument[] = { 0x48, 0xBE };                      // mov rsi, imm64
+#endif
+
+	// ModRM bytes of the 0x83 group (op r/m64, imm8) with r12 as the operand
+	constexpr uint8_t kAddR12 = 0xC4;
+	constexpr uint8_t kSubR12 = 0xEC;
+	constexpr uint8_t kCmpR12 = 0xFC;
+
+	// Encoding of rbx, the base of every memory operand
+	constexpr uint8_t kRbx = 3;
+
+	constexpr uint8_t ToCode(X64Emitter::Reg reg)
+	{
+		return static_cast<uint8_t>(reg);
+	}
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitPrologue()
+{
+	[[maybe_unused]] const size_t start = mCode.size();
+
+	Emit(0x53);                                    // push rbx
+	Emit(0x55);                                    // push rbp
+	Emit(0x41); Emit(0x54);                        // push r12
+	Emit(0x48); Emit(0x83); Emit(0xEC); Emit(kFrameSize); // sub rsp, frame
+	for (uint8_t byte : kMoveBasesFromArguments)
+	{
+		Emit(byte);
+	}
+	for (uint8_t byte : kMoveBudgetFromArgument)
+	{
+		Emit(byte);
+	}
+
+	assert(mCode.size() - start == kChainEntryOffset);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitEpilogue()
+{
+	Emit(0x48); Emit(0x83); Emit(0xC4); Emit(kFrameSize); // add rsp, frame
+	Emit(0x41); Emit(0x5C);                        // pop r12
+	Emit(0x5D);                                    // pop rbp
+	Emit(0x5B);                                    // pop rbx
+	Emit(0xC3);                                    // ret
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitEnterBlock(uint8_t opCount)
+{
+	EmitAdjustBudget(kCmpR12, opCount);
+	const size_t isCovered = EmitJump(Condition::AboveOrEqual);
+	EmitReturnExecuted(0);
+	PatchJump(isCovered);
+	EmitAdjustBudget(kSubR12, opCount);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitReturnExecuted(uint8_t unretiredOps)
+{
+	EmitAdjustBudget(kAddR12, unretiredOps);
+	Emit(0x4C); Emit(0x89); Emit(0xE0);            // mov rax, r12
+	EmitEpilogue();
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitReturnStatus(uint8_t unretiredOps)
+{
+	EmitAdjustBudget(kAddR12, unretiredOps);
+	Emit(0x48); Emit(0xC1); Emit(0xE0); Emit(32);  // shl rax, 32
+	Emit(0x4C); Emit(0x09); Emit(0xE0);            // or rax, r12
+	EmitEpilogue();
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitChain(const void* slot, uint8_t unretiredOps)
+{
+	EmitAdjustBudget(kAddR12, unretiredOps);
+
+	Emit(0x48); Emit(0xB8);                        // mov rax, imm64
+	Emit64(reinterpret_cast<uint64_t>(slot));
+	Emit(0x48); Emit(0x8B); Emit(0x00);            // mov rax, [rax]
+	Emit(0x48); Emit(0x85); Emit(0xC0);            // test rax, rax
+	const size_t isNotCompiled = EmitJump(Condition::Equal);
+	Emit(0x48); Emit(0x83); Emit(0xC0); Emit(static_cast<uint8_t>(kChainEntryOffset)); // add rax, entry
+	Emit(0xFF); Emit(0xE0);                        // jmp rax
+
+	PatchJump(isNotCompiled);
+	EmitReturnExecuted(0);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitStoreImm16(int32_t displacement, uint16_t value)
+{
+	Emit(0x66); Emit(0xC7);                        // mov word [rbx + disp], imm16
+	EmitMemoryOperand(0, displacement);
+	Emit(static_cast<uint8_t>(value));
+	Emit(static_cast<uint8_t>(value >> 8));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitLoad8(Reg reg, int32_t displacement)
+{
+	EmitRex(ToCode(reg), kRbx, true);
+	Emit(0x8A);                                    // mov r8, [rbx + disp]
+	EmitMemoryOperand(ToCode(reg), displacement);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitStore8(int32_t displacement, Reg reg)
+{
+	EmitRex(ToCode(reg), kRbx, true);
+	Emit(0x88);                                    // mov [rbx + disp], r8
+	EmitMemoryOperand(ToCode(reg), displacement);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitLoadWord(Reg reg, int32_t displacement)
+{
+	Emit(0x66);
+	EmitRex(ToCode(reg), kRbx, false);
+	Emit(0x8B);                                    // mov r16, [rbx + disp]
+	EmitMemoryOperand(ToCode(reg), displacement);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitStoreWord(int32_t displacement, Reg reg)
+{
+	Emit(0x66);
+	EmitRex(ToCode(reg), kRbx, false);
+	Emit(0x89);                                    // mov [rbx + disp], r16
+	EmitMemoryOperand(ToCode(reg), displacement);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitCompareWordImm16(int32_t displacement, uint16_t value)
+{
+	Emit(0x66); Emit(0x81);                        // cmp word [rbx + disp], imm16
+	EmitMemoryOperand(7, displacement);
+	Emit(static_cast<uint8_t>(value));
+	Emit(static_cast<uint8_t>(value >> 8));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitMoveImm8(Reg reg, uint8_t value)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(static_cast<uint8_t>(0xB0 | (ToCode(reg) & 7))); // mov r8, imm8
+	Emit(value);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitMoveImmWord(Reg reg, uint16_t value)
+{
+	Emit(0x66);
+	EmitRex(0, ToCode(reg), false);
+	Emit(static_cast<uint8_t>(0xB8 | (ToCode(reg) & 7))); // mov r16, imm16
+	Emit(static_cast<uint8_t>(value));
+	Emit(static_cast<uint8_t>(value >> 8));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitMove8(Reg destination, Reg source)
+{
+	EmitRex(ToCode(source), ToCode(destination), true);
+	Emit(0x88);                                    // mov r/m8, r8
+	EmitRegisterOperand(ToCode(source), ToCode(destination));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitAlu8(AluOp op, Reg destination, Reg source)
+{
+	EmitRex(ToCode(destination), ToCode(source), true);
+	Emit(static_cast<uint8_t>(op));                // op r8, r/m8
+	EmitRegisterOperand(ToCode(destination), ToCode(source));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitAddImm8(Reg reg, uint8_t value)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0x80);                                    // add r8, imm8
+	EmitRegisterOperand(0, ToCode(reg));
+	Emit(value);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitCompareImm8(Reg reg, uint8_t value)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0x80);                                    // cmp r8, imm8
+	EmitRegisterOperand(7, ToCode(reg));
+	Emit(value);
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitShiftLeft1(Reg reg)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0xD0);                                    // shl r8, 1
+	EmitRegisterOperand(4, ToCode(reg));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitShiftRight1(Reg reg)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0xD0);                                    // shr r8, 1
+	EmitRegisterOperand(5, ToCode(reg));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitSetCarry(Reg reg)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0x0F); Emit(0x92);                        // setc r8
+	EmitRegisterOperand(0, ToCode(reg));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitSetNotCarry(Reg reg)
+{
+	EmitRex(0, ToCode(reg), true);
+	Emit(0x0F); Emit(0x93);                        // setnc r8
+	EmitRegisterOperand(0, ToCode(reg));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitAddByteToWord(Reg word, Reg byte)
+{
+	EmitRex(0, ToCode(byte), true);
+	Emit(0x0F); Emit(0xB6);                        // movzx eax, r8
+	EmitRegisterOperand(0, ToCode(byte));
+	Emit(0x66);
+	EmitRex(0, ToCode(word), false);
+	Emit(0x01);                                    // add r16, ax
+	EmitRegisterOperand(0, ToCode(word));
+}
+
+//--------------------------------------------------------------------------------
+size_t X64Emitter::EmitCallHandler(const void* function, const void* argument)
+{
+	for (uint8_t byte : kMoveCpuToFirstArgument)
+	{
+		Emit(byte);
+	}
+	for (uint8_t byte : kMoveImm64ToSecondArgument)
+	{
+		Emit(byte);
+	}
+	Emit64(reinterpret_cast<uint64_t>(argument));
+
+	Emit(0x48); Emit(0xB8);                        // mov rax, imm64
+	Emit64(reinterpret_cast<uint64_t>(function));
+	Emit(0xFF); Emit(0xD0);                        // call rax
+
+	// ExecutionStatus::Executed is zero
+	Emit(0x85); Emit(0xC0);                        // test eax, eax
+	return EmitJump(Condition::Equal);
+}
+
+//--------------------------------------------------------------------------------
+size_t X64Emitter::EmitJump(Condition condition)
+{
+	// Near form 0F 8x rel32 of the short 7x rel8, so any block fits
+	Emit(0x0F);
+	Emit(static_cast<uint8_t>(static_cast<uint8_t>(condition) + 0x10));
+	Emit32(0);
+	return mCode.size() - 4;
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::PatchJump(size_t position)
+{
+	const uint32_t distance = static_cast<uint32_t>(mCode.size() - (position + 4));
+	for (size_t i = 0; i < 4; ++i)
+	{
+		mCode[position + i] = static_cast<uint8_t>(distance >> (i * 8));
+	}
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::Emit32(uint32_t value)
+{
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		Emit(static_cast<uint8_t>(value >> shift));
+	}
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::Emit64(uint64_t value)
+{
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		Emit(static_cast<uint8_t>(value >> shift));
+	}
+}
+
+// op r12, imm8 for an 0x83 group ModRM byte. Adding or subtracting zero emits nothing.
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitAdjustBudget(uint8_t opCode, uint8_t opCount)
+{
+	assert(opCount <= 127 && "Budget adjustment must fit a signed byte");
+	if (opCount == 0 && opCode != kCmpR12)
+	{
+		return;
+	}
+
+	Emit(0x49); Emit(0x83); Emit(opCode); Emit(opCount); // op r12, imm8
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitRex(uint8_t reg, uint8_t rm, bool isByteAccess)
+{
+	const uint8_t rex = static_cast<uint8_t>(0x40 | ((reg >> 3) << 2) | (rm >> 3));
+	const bool needsEmptyRex = isByteAccess && ((reg >= 4 && reg <= 7) || (rm >= 4 && rm <= 7));
+	if (rex != 0x40 || needsEmptyRex)
+	{
+		Emit(rex);
+	}
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitRegisterOperand(uint8_t reg, uint8_t rm)
+{
+	// ModRM: mod = 11 (register), reg, rm
+	Emit(static_cast<uint8_t>(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+}
+
+//--------------------------------------------------------------------------------
+void X64Emitter::EmitMemoryOperand(uint8_t reg, int32_t displacement)
+{
+	// ModRM: mod = 01 (disp8) or 10 (disp32), reg, rm = 011 (rbx)
+	if (displacement >= -128 && displacement <= 127)
+	{
+		Emit(static_cast<uint8_t>(0x40 | ((reg & 7) << 3) | kRbx));
+		Emit(static_cast<uint8_t>(displacement));
+		return;
+	}
+
+	Emit(static_cast<uint8_t>(0x80 | ((reg & 7) << 3) | kRbx));
+	Emit32(static_cast<uint32_t>(displacement));
+}
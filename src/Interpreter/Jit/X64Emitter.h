@@ -0,0 +1,102 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Minimal x86-64 encoder for the JIT. Every memory operand is [rbx + displacement],
+// where rbx holds the CPUState pointer for the whole block and rbp holds the CPU.
+// Register operands are used at byte width, except where a name says Word.
+//
+// r12 holds the instructions left in the caller's budget. Each block takes its
+// ops from it on entry and every exit returns it, so a run of chained blocks
+// reports what it retired in one value: (status << 32) | budget left.
+//--------------------------------------------------------------------------------
+class X64Emitter
+{
+public:
+	// General-purpose registers by encoding. rax and rcx are scratch for the
+	// emitted ops; rbx, rsp, rbp and r12 are reserved.
+	enum class Reg : uint8_t { Rax = 0, Rcx = 1, Rdx = 2, Rsi = 6, Rdi = 7, R8 = 8, R9 = 9, R10 = 10, R11 = 11 };
+
+	// The remaining caller-saved registers, free to cache guest state in. Handler
+	// calls clobber them, so cached values are stored before each call.
+#if defined(_WIN32)
+	static constexpr std::array<Reg, 5> kCacheRegisters = { Reg::Rdx, Reg::R8, Reg::R9, Reg::R10, Reg::R11 };
+#else
+	static constexpr std::array<Reg, 7> kCacheRegisters = { Reg::Rdx, Reg::Rsi, Reg::Rdi, Reg::R8, Reg::R9, Reg::R10, Reg::R11 };
+#endif
+
+	// Byte-sized ALU ops of the form "op r8, r/m8", valued by opcode byte
+	enum class AluOp : uint8_t { Add = 0x02, Or = 0x0A, And = 0x22, Sub = 0x2A, Xor = 0x32, Cmp = 0x3A };
+
+	// Conditional jumps, valued by their short-form opcode byte
+	enum class Condition : uint8_t { AboveOrEqual = 0x73, Equal = 0x74, NotEqual = 0x75 };
+
+	// Bytes from a block's start to the code after its prologue, where chained
+	// blocks enter it
+	static constexpr size_t kChainEntryOffset = 17;
+
+	void EmitPrologue();
+	void EmitEpilogue();
+
+	// Returns to the caller if the budget cannot cover opCount ops, else takes them
+	void EmitEnterBlock(uint8_t opCount);
+
+	// Returns Executed, or the status in eax, handing back the budget of the
+	// block's unretiredOps ops that did not run
+	void EmitReturnExecuted(uint8_t unretiredOps);
+	void EmitReturnStatus(uint8_t unretiredOps);
+
+	// Hands back unretiredOps, then jumps into the block whose native code the
+	// slot points to, or returns Executed if the slot is null
+	void EmitChain(const void* slot, uint8_t unretiredOps);
+
+	void EmitStoreImm16(int32_t displacement, uint16_t value);
+	void EmitLoad8(Reg reg, int32_t displacement);
+	void EmitStore8(int32_t displacement, Reg reg);
+	void EmitLoadWord(Reg reg, int32_t displacement);
+	void EmitStoreWord(int32_t displacement, Reg reg);
+	void EmitCompareWordImm16(int32_t displacement, uint16_t value);
+
+	void EmitMoveImm8(Reg reg, uint8_t value);
+	void EmitMoveImmWord(Reg reg, uint16_t value);
+	void EmitMove8(Reg destination, Reg source);
+	void EmitAlu8(AluOp op, Reg destination, Reg source);
+	void EmitAddImm8(Reg reg, uint8_t value);
+	void EmitCompareImm8(Reg reg, uint8_t value);
+	void EmitShiftLeft1(Reg reg);
+	void EmitShiftRight1(Reg reg);
+	void EmitSetCarry(Reg reg);
+	void EmitSetNotCarry(Reg reg);
+	void EmitAddByteToWord(Reg word, Reg byte);
+
+	// Calls function(cpu, argument), leaving the MicroOpResult status in eax.
+	// Returns the jump taken if it is Executed, to patch past the failure exit.
+	[[nodiscard]] size_t EmitCallHandler(const void* function, const void* argument);
+
+	// Returns the position of the rel32 to hand to PatchJump once the target is known
+	[[nodiscard]] size_t EmitJump(Condition condition);
+	void PatchJump(size_t position);
+
+	const std::vector<uint8_t>& GetCode() const { return mCode; }
+	void Clear() { mCode.clear(); }
+
+private:
+	void Emit(uint8_t byte) { mCode.push_back(byte); }
+	void Emit32(uint32_t value);
+	void Emit64(uint64_t value);
+	void EmitAdjustBudget(uint8_t opCode, uint8_t opCount);
+
+	// REX prefix for the given ModRM reg and rm fields, if one is needed. Byte
+	// access to encodings 4-7 needs one even when empty, or it means AH-BH.
+	void EmitRex(uint8_t reg, uint8_t rm, bool isByteAccess);
+	void EmitRegisterOperand(uint8_t reg, uint8_t rm);
+	void EmitMemoryOperand(uint8_t reg, int32_t displacement);
+
+	std::vector<uint8_t> mCode;
+};
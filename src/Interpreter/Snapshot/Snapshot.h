@@ -3,9 +3,12 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Intepreter
+#include "Constants.h"
 #include "Interpreter/Hardware/CPUState.h"
 
 // System
+#include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -33,8 +36,11 @@ struct Snapshot
 
     // Decode metadata
     bool mDecodeSucceeded = false;             // Whether decoding succeeded
-    size_t mCycleCount = 0;                    // Interpreter cycle count at snapshot
+    uint64_t mCycleCount = 0;                  // Machine clock cycle at snapshot
 
     // CPU state snapshot (full CPU registers, etc.)
     CPUState mCPUState;
+
+    // RAM contents at snapshot, as many bytes as the machine has
+    std::vector<uint8_t> mMemory;
 };
\ No newline at end of file
@@ -3,31 +3,23 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Interpreter
-#include "Interpreter/Hardware/CPU.h"
 #include "Interpreter/Instruction/OpcodeTable.h"
 
 // System
 #include <vector>
 #include <cassert>
+#include <span>
 #include <string>
 
 //--------------------------------------------------------------------------------
-SnapshotBuilder::SnapshotBuilder(const CPU& cpu, uint64_t cycleCount)
-    : mCPU(cpu)
-    , mCycleCount(cycleCount)
+SnapshotBuilder::SnapshotBuilder(const CPUState& state, uint16_t opcode, const Instruction& instruction, std::span<const uint8_t> memory, uint64_t cycleCount)
+    : mCycleCount(cycleCount)
+    , mInstruction(instruction)
 {
-	FetchResult fetch = cpu.Peek();
-    
-    mSnapshot.mCPUState = cpu.GetState();
+    mSnapshot.mCPUState = state;
     mSnapshot.mAddress = mSnapshot.mCPUState.mProgramCounter;
-    mSnapshot.mOpcode = fetch.mOpcode;
-
-	// Only try to decode if address is valid
-    if (fetch.mIsValidAddress)
-    {
-        mInstruction = cpu.Decode(fetch.mOpcode);
-    }
-
+    mSnapshot.mOpcode = opcode;
+    mSnapshot.mMemory.assign(memory.begin(), memory.end());
     mSnapshot.mDecodeSucceeded = mInstruction.IsValid();
 }
 
@@ -57,19 +49,19 @@ std::vector<OperandInfo> SnapshotBuilder::ToOperandInfoList()
     OpcodeId opcodeId = mInstruction.GetOpcodeId();
     assert(opcodeId != OpcodeId::UNASSIGNED);
 
-    const OpcodeSpec& spec = OpcodeTable::Get(opcodeId);
-    if (spec.mOperands.empty())
+    const std::span<const OperandSpec> operands = OpcodeTable::Get(opcodeId).GetOperands();
+    if (operands.empty())
     {
         // No operands for this opcode
 		return { };
     }
 
     std::vector<OperandInfo> result;
-    result.reserve(spec.mOperands.size());
+    result.reserve(operands.size());
 
-    for (size_t i = 0; i < spec.mOperands.size(); ++i)
+    for (const OperandSpec& operand : operands)
     {
-        OperandType kind = spec.mOperands[i].mKind;
+        OperandType kind = operand.mKind;
         uint16_t value = 0;
 
         switch (kind)
@@ -81,7 +73,7 @@ std::vector<OperandInfo> SnapshotBuilder::ToOperandInfoList()
             case OperandType::Y:   value = static_cast<uint16_t>(mInstruction.GetOperandY()); break;
         }
 
-        result.push_back({ spec.mOperands[i].mLabel, value });
+        result.push_back({ operand.mLabel, value });
     }
 
     return result;
@@ -3,25 +3,27 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Interpreter
+#include "Interpreter/Hardware/MachineGeometry.h"
 #include "Interpreter/Instruction/Instruction.h"
 #include "Interpreter/Snapshot/Snapshot.h"
 
-// Forward Declarations
-//--------------------------------------------------------------------------------
-class CPU;
+// System
+#include <span>
 
+// Built from the state before the instruction at PC runs. The instruction is
+// invalid if PC could not be fetched from or the opcode did not decode. Memory
+// is the machine's whole RAM, whatever its configuration.
 //--------------------------------------------------------------------------------
 class SnapshotBuilder
 {
 public:
-    SnapshotBuilder(const CPU& cpu, uint64_t cycleCount);
+    SnapshotBuilder(const CPUState& state, uint16_t opcode, const Instruction& instruction, std::span<const uint8_t> memory, uint64_t cycleCount);
 
     Snapshot Build();
 
 private:
     std::vector<OperandInfo> ToOperandInfoList();
 
-    const CPU& mCPU;
     uint64_t mCycleCount;
     Instruction mInstruction;
     Snapshot mSnapshot;
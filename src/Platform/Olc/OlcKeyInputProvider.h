@@ -9,7 +9,7 @@
 #include "olcPixelGameEngine.h"
 
 //--------------------------------------------------------------------------------
-class OlcKeyInputProvider : public IKeyInputProvider
+class OlcKeyInputProvider final : public IKeyInputProvider
 {
 public:
 	explicit OlcKeyInputProvider(const olc::PixelGameEngine& pge)
@@ -0,0 +1,20 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <cstdint>
+#include <span>
+
+// Read-only view of a machine's framebuffer, for code that is not built per
+// geometry (see BasicDisplay::GetView). Each pixel is a byte of plane bits,
+// 0 when the pixel is off.
+//--------------------------------------------------------------------------------
+struct DisplayView
+{
+	std::span<const uint8_t> mPixels;
+	uint32_t mWidth = 0;
+	uint32_t mHeight = 0;
+
+	uint8_t GetPixel(uint32_t x, uint32_t y) const { return mPixels[x + y * mWidth]; }
+};
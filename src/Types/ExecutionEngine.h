@@ -0,0 +1,12 @@
+#pragma once
+
+// Selects how Interpreter::RunCycles dispatches instructions.
+//--------------------------------------------------------------------------------
+enum class ExecutionEngine
+{
+	kSwitch,   // Step() per instruction through CPU::Execute's switch
+	kThreaded, // Direct-threaded dispatch, one indirect jump per instruction
+	kBlock,    // Cached basic blocks of pre-bound micro-ops, one dispatch per block
+	kJit,      // kBlock plus native x86-64 code for hot blocks (kBlock elsewhere)
+	kClosure,  // Per-instruction closures with captured operands, one indirect call each
+};
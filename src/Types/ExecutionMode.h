@@ -0,0 +1,9 @@
+#pragma once
+
+// How much validation the opcode handlers do (see Quirks.h for how it is bound).
+//--------------------------------------------------------------------------------
+enum class ExecutionMode
+{
+	kUnchecked, // Addresses and the stack pointer are masked, never bounds-tested
+	kChecked,   // Every memory and stack access is validated and faults are reported
+};
@@ -9,5 +9,10 @@ enum class ExecutionStatus
 	MissingHandler,
 	WaitingOnKeyPress,
 	InvalidAddressUnaligned,
-	InvalidAddressOutOfBounds
+	InvalidAddressOutOfBounds,
+	StackOverflow,
+	StackUnderflow,
+	InvalidKey,   // Ex9E/ExA1 with Vx above 0xF (checked mode)
+	InvalidDigit, // Fx29 or Fx30 with Vx above 0xF (checked mode)
+	ProgramExited
 };
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+// Instruction set a ROM is written for (see Interpreter::LoadRom). Each set
+// extends the one before it, so they compare in that order.
+//
+// High-res mode (00FF) needs a machine built for a 128x64 geometry; on the
+// 64x32 CHIP-8 geometry it reports NotImplemented. XO-CHIP programs also
+// expect XoChipGeometry's 64 KB, which F000 nnnn addresses. The app picks the
+// set and geometry by file extension (.sc8, .xo8).
+//--------------------------------------------------------------------------------
+enum class InstructionSet
+{
+	kChip8,     // CHIP-8 3.1 base set
+	kSuperChip, // Adds the SUPER-CHIP 1.1 high-res, scrolling, 16x16 sprite, font and flag opcodes
+	kXoChip,    // Adds the XO-CHIP scroll up, register range, long I load, bit plane and audio opcodes
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+// Legacy behaviour set a ROM expects (see Quirks.h for what each one changes).
+//--------------------------------------------------------------------------------
+enum class QuirkProfile
+{
+	kModern, // Behaviour most current ROMs and test suites assume
+	kCosmac, // Original COSMAC VIP interpreter
+	kSchip,  // SUPER-CHIP 1.1 on the HP 48
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Project
+#include "ExecutionStatus.h"
+#include "StopReason.h"
+
+// System
+#include <cstddef>
+
+//--------------------------------------------------------------------------------
+struct RunResult
+{
+	size_t mCyclesExecuted = 0;
+	ExecutionStatus mStatus = ExecutionStatus::Executed; // Status of the last instruction
+	bool mShouldHalt = false;
+	StopReason mStopReason = StopReason::kBudgetExhausted;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// System
+#include <cstdint>
+#include <optional>
+#include <span>
+
+// Optional reasons for Interpreter::RunCycles to return before its budget is
+// spent. Halts and Fx0A waits always stop a run.
+//--------------------------------------------------------------------------------
+struct StopConditions
+{
+	bool mStopOnDisplayChange = false;
+
+	// Addresses to stop at before executing. A run never stops on its first
+	// instruction, so resuming from a breakpoint makes progress.
+	std::span<const uint16_t> mBreakpoints;
+
+	// Machine clock cycle to stop at (see MachineClock), before executing the
+	// first instruction due at or after it; a timed instruction can step past it.
+	// A run starting at or past it continues.
+	std::optional<uint64_t> mStopAtCycle;
+
+	bool IsEmpty() const { return !mStopOnDisplayChange && mBreakpoints.empty() && !mStopAtCycle.has_value(); }
+};
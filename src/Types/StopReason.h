@@ -0,0 +1,13 @@
+#pragma once
+
+// Why Interpreter::RunCycles returned.
+//--------------------------------------------------------------------------------
+enum class StopReason
+{
+	kBudgetExhausted,   // Ran the full cycle budget
+	kHalted,            // An instruction failed (see RunResult::mStatus)
+	kWaitingOnKeyPress, // Fx0A is waiting for a key release
+	kDisplayChanged,    // The last instruction changed the display
+	kBreakpoint,        // PC reached a breakpoint (the instruction there has not run)
+	kCycleReached,      // The machine clock reached StopConditions::mStopAtCycle
+};
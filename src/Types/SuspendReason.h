@@ -0,0 +1,14 @@
+#pragma once
+
+// Why MachineDriver::Resume returned.
+//--------------------------------------------------------------------------------
+enum class SuspendReason
+{
+	kBudgetExhausted,   // Ran the full cycle budget
+	kTimerTick,         // The 60 Hz timers were just decremented
+	kWaitingOnKeyPress, // Fx0A started waiting for a key release
+	kDisplayChanged,    // The last instruction changed the display
+	kBreakpoint,        // PC reached a breakpoint (the instruction there has not run)
+	kCycleReached,      // The machine clock reached StopConditions::mStopAtCycle
+	kHalted,            // An instruction failed (see Suspension::mStatus)
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Project
+#include "ExecutionStatus.h"
+#include "SuspendReason.h"
+
+// System
+#include <cstddef>
+
+//--------------------------------------------------------------------------------
+struct Suspension
+{
+	SuspendReason mReason = SuspendReason::kBudgetExhausted;
+	size_t mCyclesElapsed = 0; // Since the resume, including cycles idled in a key wait
+	ExecutionStatus mStatus = ExecutionStatus::Executed; // Status of the last instruction
+};
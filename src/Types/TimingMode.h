@@ -0,0 +1,9 @@
+#pragma once
+
+// What a cycle of the machine clock is (see Interpreter::SetTimingMode).
+//--------------------------------------------------------------------------------
+enum class TimingMode
+{
+	kInstruction, // Every instruction takes one cycle of the 500 Hz clock
+	kCosmacVip,   // Instructions cost their COSMAC VIP machine cycles (see CosmacVipTiming)
+};
@@ -24,5 +24,7 @@ struct UITheme
 	inline static const olc::Pixel kColorBG = olc::VERY_DARK_GREY;				    // Used
 	inline static const olc::Pixel kColorScreenOn = olc::WHITE;						// USED
 	inline static const olc::Pixel kColorScreenOff = olc::Pixel(100, 149, 237);	    // dark cornflower blue tone
+	inline static const olc::Pixel kColorScreenPlane2 = olc::Pixel(30, 40, 90);	    // XO-CHIP second plane only
+	inline static const olc::Pixel kColorScreenBothPlanes = olc::Pixel(255, 200, 60); // XO-CHIP both planes
 	inline static const olc::Pixel kBackgroundColor = olc::Pixel(20, 25, 45); // muted dark blue
 };
\ No newline at end of file
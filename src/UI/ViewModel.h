@@ -3,19 +3,18 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Project
+#include "Interpreter/Hardware/Keypad.h"
 #include "Interpreter/Snapshot/Snapshot.h"
+#include "Types/DisplayView.h"
 
 // System
 #include <string>
 
-// Forward Declarations
-//--------------------------------------------------------------------------------
-struct Bus;
-
 //--------------------------------------------------------------------------------
 struct ViewModel
 {
-	Bus* mBus = nullptr;
+	Keypad* mKeypad = nullptr;
+	DisplayView mDisplay;     // Of whichever machine the loaded ROM needs
     Snapshot mSnapshot;
 	std::string mNotficationText;
 	bool mIsDisplayInteractive = false;
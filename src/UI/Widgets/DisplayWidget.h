@@ -6,21 +6,32 @@
 #include "Constants.h"
 #include "UI/Layout/FramedWidgetBase.h"
 #include "Platform/Olc/OlcVec.h"
-#include "Interpreter/Bus.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Types/DisplayView.h"
 
 // Third Party
 #include "olcPixelGameEngine.h"
 
 // System
+#include <array>
 #include <cassert>
 
+// Shows any machine's framebuffer at the same on-screen size: the framebuffer
+// has the largest geometry's resolution, and a lower-resolution view fills it
+// with blocks.
 //--------------------------------------------------------------------------------
 class DisplayWidget : public FramedWidgetBase
 {
+	static constexpr int32_t kFramebufferWidth = static_cast<int32_t>(SuperChipGeometry::kDisplayWidth);
+	static constexpr int32_t kFramebufferHeight = static_cast<int32_t>(SuperChipGeometry::kDisplayHeight);
+	static constexpr int32_t kFramebufferScale = UITheme::kPixelScale * DISPLAY_WIDTH / kFramebufferWidth;
+
+	static_assert(kFramebufferScale * kFramebufferWidth == UITheme::kPixelScale * DISPLAY_WIDTH, "Pixel scale must divide evenly");
+
 public:
 	explicit DisplayWidget(olc::PixelGameEngine& pge)
 		: FramedWidgetBase(pge, "Display")
-		, mFramebuffer(DISPLAY_WIDTH, DISPLAY_HEIGHT)
+		, mFramebuffer(kFramebufferWidth, kFramebufferHeight)
 	{
 		mFrame.SetContentSize(GetInternalContentSize());
 	}
@@ -34,17 +45,25 @@ public:
 private:
 	void UpdateFramebuffer(const ViewModel& viewModel)
 	{
-		const Display& display = viewModel.mBus->mDisplay;
+		const DisplayView& display = viewModel.mDisplay;
+		assert(display.mWidth > 0 && kFramebufferWidth % static_cast<int32_t>(display.mWidth) == 0);
+
+		// Indexed by the pixel's plane bits
+		const std::array<olc::Pixel, 4> colors = {
+			UITheme::kColorScreenOff,
+			UITheme::kColorScreenOn,
+			UITheme::kColorScreenPlane2,
+			UITheme::kColorScreenBothPlanes
+		};
 
-		for (int32_t y = 0; y < DISPLAY_HEIGHT; ++y)
+		const int32_t blockSize = kFramebufferWidth / static_cast<int32_t>(display.mWidth);
+
+		for (int32_t y = 0; y < kFramebufferHeight; ++y)
 		{
-			for (int32_t x = 0; x < DISPLAY_WIDTH; ++x)
+			for (int32_t x = 0; x < kFramebufferWidth; ++x)
 			{
-				const olc::Pixel color = display.IsPixelSet(x, y)
-					? UITheme::kColorScreenOn
-					: UITheme::kColorScreenOff;
-
-				mFramebuffer.SetPixel(x, y, color);
+				const uint8_t planes = display.GetPixel(static_cast<uint32_t>(x / blockSize), static_cast<uint32_t>(y / blockSize));
+				mFramebuffer.SetPixel(x, y, colors[planes & 0x3]);
 			}
 		}		
 	}
@@ -54,9 +73,8 @@ private:
 		mFrame.Draw(mPge);
 
 		const olc::vi2d position = ToOLCVecInt(mFrame.GetContentOffset());
-		const int32_t scale = UITheme::kPixelScale;		
 
-		mPge.DrawSprite(position, &mFramebuffer, scale);
+		mPge.DrawSprite(position, &mFramebuffer, kFramebufferScale);
 	}
 
 	IntVec2 GetInternalContentSize() const
@@ -66,4 +84,4 @@ private:
 	}
 		
 	olc::Sprite mFramebuffer;	
-};
\ No newline at end of file
+};
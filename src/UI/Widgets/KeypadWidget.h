@@ -5,7 +5,7 @@
 // Interpreter
 #include "Constants.h"
 #include "UI/Layout/FramedWidgetBase.h"
-#include "Interpreter/Bus.h"
+#include "Interpreter/Hardware/Keypad.h"
 
 // System
 #include <cstdint>
@@ -37,7 +37,7 @@ public:
 
 	virtual void Draw(const ViewModel& viewModel) override
 	{
-		Keypad& keypad = viewModel.mBus->mKeypad;
+		Keypad& keypad = *viewModel.mKeypad;
 
 		mFrame.Draw(mPge);
 
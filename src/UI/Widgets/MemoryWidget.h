@@ -28,7 +28,6 @@ public:
 
 	virtual void Draw(const ViewModel& viewModel) override
     {
-        const RAM& ram = viewModel.mBus->mRAM;
 		const Snapshot& snapshot = viewModel.mSnapshot;
 
         mFrame.Draw(mPge);
@@ -59,7 +58,7 @@ public:
         for (int16_t i = 0; i < kNumLines; ++i)
         {
             uint16_t address = static_cast<uint16_t>(startAddress + i * bytesPerLine);
-            if (address >= RAM_SIZE) { continue; }
+            if (address >= snapshot.mMemory.size()) { continue; }
 
             std::string prefix = (i == cursorLine) ? ">0x" : " 0x";
             std::string line = prefix + ToHexString(address, 4) + ": ";
@@ -67,8 +66,8 @@ public:
             for (int16_t b = 0; b < bytesPerLine; ++b)
             {
                 uint16_t byteAddress = static_cast<uint16_t>(address + b);
-                line += (byteAddress < RAM_SIZE)
-                    ? ToHexString(ram.Read(byteAddress), 2) + " "
+                line += (byteAddress < snapshot.mMemory.size())
+                    ? ToHexString(snapshot.mMemory[byteAddress], 2) + " "
                     : "?? ";
             }
 
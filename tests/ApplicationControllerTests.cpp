@@ -90,7 +90,7 @@ public:
 		EXPECT_CALL(*mUIManager, SetOnRomSelectedCallback(_))
 			.WillOnce(testing::SaveArg<0>(&mRomSelectCallback));
 
-		mController = std::make_unique<ApplicationController>(			
+		mController = std::make_unique<ApplicationController<DummyKeyInputProvider>>(			
 			std::move(romLoader),
 			std::move(config.mUIManager)			
 		);
@@ -123,9 +123,10 @@ public:
 	MockUIManager& GetUIManager() { return *mUIManager; }
 	ExecutionState GetExecutionState() { return mController->mState; }
 	const Snapshot& GetSnapshot() { return mController->mViewModel.mSnapshot; }
+	const auto& GetInterpreter() const { return std::get<0>(mController->mMachine).mInterpreter; } // dummy.rom loads as CHIP-8
 
 private:
-	std::unique_ptr<ApplicationController> mController;
+	std::unique_ptr<ApplicationController<DummyKeyInputProvider>> mController;
 	MockUIManager* mUIManager; // Non-owning
 	std::function<void(size_t)> mRomSelectCallback;
 
@@ -295,6 +296,92 @@ TEST_F(ApplicationControllerTestFixture, Play_ShouldHaltWhenInvalidInstructionEx
 	AssertNotificationHalted(vm, ExecutionStatus::DecodeError);
 }
 
+//--------------------------------------------------------------------------------
+TEST_F(ApplicationControllerTestFixture, Play_ShouldTickTimersOnEmulatedCycles)
+{
+	/*
+		Verifies the machine driver ticks the timers while playing.
+
+		Checks:
+		- The delay timer has dropped once per 60 Hz tick of the emulated clock.
+	*/
+
+	// Arrange
+	std::vector<uint8_t> romData = {
+		0x60, 0x40,  // LD V0, 0x40
+		0xF0, 0x15,  // LD DT, V0
+		0x12, 0x04   // JP 0x204 (loop)
+	};
+	AppControllerDriverConfig config(romData);
+	auto driver = CreateAppControllerDriver(std::move(config));
+	driver->SelectRom(0);
+
+	// Act
+	driver->HandleCommand(Commands::kPlay);
+	for (int frame = 0; frame < 6; ++frame)
+	{
+		driver->RunFrame();
+	}
+
+	// Assert
+	const auto& interpreter = driver->GetInterpreter();
+	const uint64_t ticks = interpreter.GetClock().CountTicks(interpreter.GetClock().GetCycles(), static_cast<uint32_t>(SYSTEM_TIMER_HZ));
+
+	ASSERT_EQ(driver->GetExecutionState(), ExecutionState::kPlaying);
+	ASSERT_GT(ticks, 0u);
+	ASSERT_EQ(interpreter.GetCPU().GetState().mDelayTimer, 0x40 - ticks);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(ApplicationControllerTestFixture, Play_ShouldHaltAfterRunningAcrossFrames)
+{
+	/*
+		Verifies a fault reached after several frames and timer ticks halts the
+		emulator, and that Reset restarts the machine driver.
+
+		Checks:
+		- Runs frames until the fault, then transitions to Halted.
+		- Every instruction before the fault ran.
+		- After Reset, Play runs the program again from the start.
+	*/
+
+	// Arrange
+	std::vector<uint8_t> romData = {
+		0x71, 0x01,  // ADD V1, 1
+		0x31, 0x14,  // SE V1, 20
+		0x12, 0x00,  // JP 0x200 (loop)
+		0xFF, 0xFF   // Invalid opcode
+	};
+	AppControllerDriverConfig config(romData);
+	auto driver = CreateAppControllerDriver(std::move(config));
+	driver->SelectRom(0);
+
+	// Act
+	driver->HandleCommand(Commands::kPlay);
+	int frames = 0;
+	while (driver->GetExecutionState() == ExecutionState::kPlaying && frames < 60)
+	{
+		driver->RunFrame();
+		++frames;
+	}
+
+	// Assert
+	ASSERT_EQ(driver->GetExecutionState(), ExecutionState::kHalted);
+	ASSERT_GT(frames, 1);
+	ASSERT_EQ(driver->GetInterpreter().GetCPU().GetState().mRegisters[1], 20);
+	AssertNotificationHalted(driver->GetViewModel(), ExecutionStatus::DecodeError);
+
+	// Act
+	driver->HandleCommand(Commands::kReset);
+	driver->HandleCommand(Commands::kPlay);
+	driver->RunFrame();
+
+	// Assert
+	ASSERT_EQ(driver->GetExecutionState(), ExecutionState::kPlaying);
+	ASSERT_GT(driver->GetInterpreter().GetCPU().GetState().mRegisters[1], 0);
+	ASSERT_LT(driver->GetInterpreter().GetCPU().GetState().mRegisters[1], 20);
+}
+
 //--------------------------------------------------------------------------------
 TEST_F(ApplicationControllerTestFixture, InstructionInfo_ShouldRemainFrozenWhilePlaying)
 {
@@ -0,0 +1,126 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class BlockCacheTest : public InterpreterTest<::testing::Test>
+{
+protected:
+    BlockCacheTest()
+        : InterpreterTest(ExecutionEngine::kBlock)
+    { }
+};
+
+//--------------------------------------------------------------------------------
+TEST_F(BlockCacheTest, BlockEndsAtControlFlowAndIsReused)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x61, 0x02, // 0x202: LD V1, 2
+        0x72, 0x01, // 0x204: ADD V2, 1
+        0x12, 0x04, // 0x206: JP 0x204
+        0x63, 0x03  // 0x208: LD V3, 3 (never reached)
+    }));
+
+    // -- Act --
+    mInterpreter.RunCycles(4);
+
+    // -- Assert --
+    const BlockCache& cache = mInterpreter.GetBlockCache();
+    const TranslatedBlock* block = cache.Find(PROGRAM_START_ADDRESS);
+    ASSERT_NE(nullptr, block);
+    EXPECT_EQ(4u, block->mOps.size());
+    EXPECT_EQ(PROGRAM_START_ADDRESS + 8, block->mEndAddress);
+
+    // -- Act --: the loop body at 0x204 is translated once and then reused
+    mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(2u, cache.GetTranslationCount());
+    EXPECT_EQ(51, mInterpreter.GetCPU().GetState().mRegisters[2]);
+    EXPECT_EQ(0, mInterpreter.GetCPU().GetState().mRegisters[3]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(BlockCacheTest, BudgetSplitsBlock)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x61, 0x02, // 0x202: LD V1, 2
+        0x62, 0x03, // 0x204: LD V2, 3
+        0x12, 0x00  // 0x206: JP 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(2);
+
+    // -- Assert --
+    const CPUState& state = mInterpreter.GetCPU().GetState();
+    EXPECT_EQ(2u, result.mCyclesExecuted);
+    EXPECT_EQ(PROGRAM_START_ADDRESS + 4, state.mProgramCounter);
+    EXPECT_EQ(2, state.mRegisters[1]);
+    EXPECT_EQ(0, state.mRegisters[2]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(BlockCacheTest, SelfModifyingCodeIsRetranslated)
+{
+    // -- Arrange --: the program overwrites its first instruction with LD V3, 7
+    ASSERT_TRUE(LoadRom({
+        0x63, 0x05, // 0x200: LD V3, 5
+        0x60, 0x63, // 0x202: LD V0, 0x63
+        0x61, 0x07, // 0x204: LD V1, 0x07
+        0xA2, 0x00, // 0x206: LD I, 0x200
+        0xF1, 0x55, // 0x208: LD [I], V1
+        0x12, 0x00  // 0x20A: JP 0x200
+    }));
+
+    // -- Act --
+    mInterpreter.RunCycles(6);
+    const uint8_t valueBeforePatch = mInterpreter.GetCPU().GetState().mRegisters[3];
+    mInterpreter.RunCycles(1);
+
+    // -- Assert --
+    EXPECT_EQ(5, valueBeforePatch);
+    EXPECT_EQ(7, mInterpreter.GetCPU().GetState().mRegisters[3]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(BlockCacheTest, WritesOutsideBlocksKeepThemCached)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // ADD V0, 1
+        0x12, 0x00  // JP 0x200
+    }));
+    mInterpreter.RunCycles(2);
+
+    // -- Act --
+    mInterpreter.GetBus().mRAM.Write(0x300, 0xFF);
+
+    // -- Assert --
+    EXPECT_NE(nullptr, mInterpreter.GetBlockCache().Find(PROGRAM_START_ADDRESS));
+
+    // -- Act --
+    mInterpreter.GetBus().mRAM.Write(PROGRAM_START_ADDRESS + 3, 0x02);
+
+    // -- Assert --
+    EXPECT_EQ(nullptr, mInterpreter.GetBlockCache().Find(PROGRAM_START_ADDRESS));
+}
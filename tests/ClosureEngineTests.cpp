@@ -0,0 +1,101 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Engine/ClosureCache.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class ClosureEngineTest : public InterpreterTest<::testing::Test>
+{
+protected:
+    ClosureEngineTest()
+        : InterpreterTest(ExecutionEngine::kClosure)
+    { }
+};
+
+//--------------------------------------------------------------------------------
+TEST_F(ClosureEngineTest, CompilesEachAddressOnce)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x12, 0x00  // 0x202: JP 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(100u, result.mCyclesExecuted);
+    EXPECT_EQ(50, mInterpreter.GetCPU().GetState().mRegisters[0]);
+    EXPECT_EQ(2u, mInterpreter.GetClosureCache().GetCompileCount());
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(ClosureEngineTest, SelfModifyingCodeIsRecompiled)
+{
+    // -- Arrange --: the program overwrites its first instruction with LD V3, 7
+    ASSERT_TRUE(LoadRom({
+        0x63, 0x05, // 0x200: LD V3, 5
+        0x60, 0x63, // 0x202: LD V0, 0x63
+        0x61, 0x07, // 0x204: LD V1, 0x07
+        0xA2, 0x00, // 0x206: LD I, 0x200
+        0xF1, 0x55, // 0x208: LD [I], V1
+        0x12, 0x00  // 0x20A: JP 0x200
+    }));
+
+    // -- Act --
+    mInterpreter.RunCycles(7);
+
+    // -- Assert --
+    EXPECT_EQ(7, mInterpreter.GetCPU().GetState().mRegisters[3]);
+    EXPECT_EQ(7u, mInterpreter.GetClosureCache().GetCompileCount());
+}
+
+// The captured Vx may be VF itself, in which case the flag write must win.
+//--------------------------------------------------------------------------------
+TEST_F(ClosureEngineTest, FlagRegisterOperandsMatchSwitchEngine)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x6F, 0xF0, // LD VF, 0xF0
+        0x61, 0x20, // LD V1, 0x20
+        0x8F, 0x14, // ADD VF, V1
+        0x62, 0x10, // LD V2, 0x10
+        0x8F, 0x25, // SUB VF, V2
+        0x6F, 0x05, // LD VF, 5
+        0x8F, 0x17, // SUBN VF, V1
+        0x80, 0xF4, // ADD V0, VF
+        0xF0, 0x1E, // ADD I, V0
+        0x3F, 0x01, // SE VF, 1
+        0x70, 0x40, // ADD V0, 0x40
+        0x9F, 0x10, // SNE VF, V1
+        0x70, 0x01  // ADD V0, 1
+    };
+
+    StubRandomProvider expectedRandom;
+    Interpreter expected(expectedRandom);
+    ASSERT_TRUE(expected.LoadRom(rom));
+    ASSERT_TRUE(LoadRom(rom));
+
+    // -- Act --
+    const RunResult expectedResult = expected.RunCycles(13);
+    const RunResult actualResult = mInterpreter.RunCycles(13);
+
+    // -- Assert --
+    EXPECT_EQ(expectedResult.mCyclesExecuted, actualResult.mCyclesExecuted);
+    EXPECT_EQ(expected.GetCPU().GetState(), mInterpreter.GetCPU().GetState());
+}
@@ -0,0 +1,147 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Application/RomLoader.h"
+#include "Constants.h"
+#include "Interpreter/Analysis/ControlFlowGraph.h"
+#include "Interpreter/Interpreter.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------------
+TEST(ControlFlowGraphTests, SplitsBlocksAtCallsSkipsAndReturnSites)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x22, 0x0A, // 0x202: CALL 0x20A
+        0x30, 0x02, // 0x204: SE V0, 2
+        0x70, 0x01, // 0x206: ADD V0, 1
+        0x12, 0x08, // 0x208: JP 0x208
+        0x70, 0x01, // 0x20A: ADD V0, 1
+        0x00, 0xEE  // 0x20C: RET
+    };
+
+    // -- Act --
+    const ControlFlowGraph graph = ControlFlowGraph::Analyze(rom);
+
+    // -- Assert --
+    const std::vector<BasicBlock>& blocks = graph.GetBlocks();
+    ASSERT_EQ(5u, blocks.size());
+
+    EXPECT_EQ(0x200, blocks[0].mStart);
+    EXPECT_EQ(0x204, blocks[0].mEnd);
+    EXPECT_EQ((std::vector<uint16_t>{ 0x20A, 0x204 }), blocks[0].mSuccessors);
+
+    EXPECT_EQ(0x204, blocks[1].mStart);
+    EXPECT_EQ((std::vector<uint16_t>{ 0x206, 0x208 }), blocks[1].mSuccessors);
+
+    EXPECT_EQ(0x206, blocks[2].mStart);
+    EXPECT_EQ((std::vector<uint16_t>{ 0x208 }), blocks[2].mSuccessors);
+
+    EXPECT_EQ(0x208, blocks[3].mStart);
+    EXPECT_EQ((std::vector<uint16_t>{ 0x208 }), blocks[3].mSuccessors);
+
+    EXPECT_EQ(0x20A, blocks[4].mStart);
+    EXPECT_EQ(2u, blocks[4].GetInstructionCount());
+    EXPECT_TRUE(blocks[4].mSuccessors.empty());
+
+    EXPECT_EQ((std::vector<uint16_t>{ 0x20A }), graph.GetSubroutines());
+    EXPECT_NE(0, graph.GetFlags(0x20A) & AddressFlags::kSubroutine);
+    EXPECT_EQ(&blocks[4], graph.FindBlock(0x20C));
+    EXPECT_TRUE(graph.GetDataRegions().empty());
+}
+
+// Bytes jumped over are data, and so is code only reached through Bnnn.
+//--------------------------------------------------------------------------------
+TEST(ControlFlowGraphTests, ReportsDataRegionsAndIndirectJumps)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x12, 0x06, // 0x200: JP 0x206
+        0xF0, 0x90, // 0x202: sprite data
+        0xF0, 0x90, // 0x204: sprite data
+        0x60, 0x00, // 0x206: LD V0, 0
+        0xB2, 0x0C, // 0x208: JP V0, 0x20C
+        0xFF,       // 0x20A: padding
+        0x00,       // 0x20B: padding
+        0x12, 0x0C  // 0x20C: JP 0x20C (only reached through Bnnn)
+    };
+
+    // -- Act --
+    const ControlFlowGraph graph = ControlFlowGraph::Analyze(rom);
+
+    // -- Assert --
+    EXPECT_EQ((std::vector<uint16_t>{ 0x208 }), graph.GetIndirectJumpSites());
+    EXPECT_NE(0, graph.GetFlags(0x208) & AddressFlags::kIndirectJump);
+    EXPECT_TRUE(graph.GetBlocks().back().mSuccessors.empty());
+
+    const std::vector<DataRegion>& data = graph.GetDataRegions();
+    ASSERT_EQ(2u, data.size());
+    EXPECT_EQ(0x202, data[0].mStart);
+    EXPECT_EQ(0x206, data[0].mEnd);
+    EXPECT_EQ(0x20A, data[1].mStart);
+    EXPECT_EQ(0x20E, data[1].mEnd);
+
+    EXPECT_TRUE(graph.IsInstruction(0x206));
+    EXPECT_NE(0, graph.GetFlags(0x207) & AddressFlags::kOperand);
+    EXPECT_NE(0, graph.GetFlags(0x202) & AddressFlags::kData);
+    EXPECT_EQ(nullptr, graph.FindBlock(0x202));
+}
+
+//--------------------------------------------------------------------------------
+TEST(ControlFlowGraphTests, FlagsUndecodableTargets)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x01, // 0x200: LD V0, 1
+        0xFF, 0xFF  // 0x202: invalid
+    };
+
+    // -- Act --
+    const ControlFlowGraph graph = ControlFlowGraph::Analyze(rom);
+
+    // -- Assert --
+    ASSERT_EQ(1u, graph.GetBlocks().size());
+    EXPECT_EQ(0x202, graph.GetBlocks()[0].mEnd);
+    EXPECT_NE(0, graph.GetFlags(0x202) & AddressFlags::kUndecodable);
+    EXPECT_FALSE(graph.IsInstruction(0x202));
+}
+
+//--------------------------------------------------------------------------------
+TEST(ControlFlowGraphTests, LoadRomPublishesAnalysis)
+{
+    // -- Arrange --
+    StubRandomProvider randomProvider;
+    Interpreter interpreter(randomProvider);
+    const RomLoader romLoader(ROMS_PATH);
+
+    for (const std::string& romName : romLoader.GetRoms())
+    {
+        // -- Act --
+        ASSERT_TRUE(interpreter.LoadRom(romLoader.LoadRom(romName)));
+        const ControlFlowGraph& graph = interpreter.GetControlFlowGraph();
+
+        // -- Assert --: every block is reachable code and the entry starts one
+        ASSERT_FALSE(graph.GetBlocks().empty()) << romName;
+        EXPECT_EQ(PROGRAM_START_ADDRESS, graph.GetBlocks().front().mStart) << romName;
+
+        for (const BasicBlock& block : graph.GetBlocks())
+        {
+            for (size_t address = block.mStart; address < block.mEnd; address += INSTRUCTION_SIZE)
+            {
+                ASSERT_TRUE(graph.IsInstruction(address)) << romName << " @ " << address;
+            }
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Driver/MachineDriver.h"
+#include "Interpreter/Instruction/CosmacVipTiming.h"
+#include "Interpreter/Instruction/OpcodeTable.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/StopConditions.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+//--------------------------------------------------------------------------------
+static Instruction DecodeOpcode(uint16_t opcode)
+{
+    return Instruction(OpcodeTable::Match(opcode), opcode);
+}
+
+// Dxyn costs more per row when the sprite straddles two display bytes.
+//--------------------------------------------------------------------------------
+TEST(CosmacVipTimingTests, DrawCostDependsOnHeightAndAlignment)
+{
+    // -- Arrange --
+    const Instruction draw = DecodeOpcode(0xD015); // DRW V0, V1, 5
+    CPUState aligned;
+    aligned.mRegisters[0] = 8;
+    CPUState unaligned;
+    unaligned.mRegisters[0] = 3;
+
+    // -- Act / Assert --
+    EXPECT_EQ(40u + 26u + 46u * 5u, CosmacVipTiming::GetCycleCost(draw, aligned));
+    EXPECT_EQ(40u + 26u + 68u * 5u, CosmacVipTiming::GetCycleCost(draw, unaligned));
+}
+
+//--------------------------------------------------------------------------------
+TEST(CosmacVipTimingTests, RegisterCopyCostDependsOnRegisterCount)
+{
+    const CPUState state;
+
+    EXPECT_EQ(40u + 14u + 14u * 4u, CosmacVipTiming::GetCycleCost(DecodeOpcode(0xF355), state));
+    EXPECT_EQ(40u + 14u + 14u * 16u, CosmacVipTiming::GetCycleCost(DecodeOpcode(0xFF65), state));
+}
+
+//--------------------------------------------------------------------------------
+class CosmacVipTimingTest : public InterpreterTest<>
+{
+protected:
+    CosmacVipTimingTest()
+    {
+        mInterpreter.SetTimingMode(TimingMode::kCosmacVip);
+        EXPECT_TRUE(LoadRom({
+            0x71, 0x01, // 0x200: ADD V1, 1  (50 cycles)
+            0x12, 0x00  // 0x202: JP 0x200   (52 cycles)
+        }));
+    }
+};
+
+//--------------------------------------------------------------------------------
+TEST_F(CosmacVipTimingTest, BudgetsAreSpentInMachineCycles)
+{
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(1020);
+
+    // -- Assert --: ten passes of 102 cycles
+    EXPECT_EQ(1020u, result.mCyclesExecuted);
+    EXPECT_EQ(10, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(1020u, mInterpreter.GetClock().GetCycles());
+    EXPECT_EQ(CosmacVipTiming::kMachineCycleHz, mInterpreter.GetClock().GetFrequencyHz());
+}
+
+// An instruction running past the budget is paid for out of the next runs.
+//--------------------------------------------------------------------------------
+TEST_F(CosmacVipTimingTest, CarriesOverspentCyclesIntoNextRun)
+{
+    // -- Act --: ADD then JP, which runs 2 cycles past the budget
+    const RunResult first = mInterpreter.RunCycles(100);
+    const RunResult paying = mInterpreter.RunCycles(2);
+
+    // -- Assert --
+    EXPECT_EQ(100u, first.mCyclesExecuted);
+    EXPECT_EQ(2u, paying.mCyclesExecuted);
+    EXPECT_EQ(1, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(PROGRAM_START_ADDRESS, mInterpreter.GetCPU().GetProgramCounter());
+
+    // -- Act --
+    const RunResult next = mInterpreter.RunCycles(50);
+
+    // -- Assert --
+    EXPECT_EQ(50u, next.mCyclesExecuted);
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(152u, mInterpreter.GetClock().GetCycles());
+}
+
+// The VIP clock is 220,080 machine cycles a second: 3668 per 60 Hz tick.
+//--------------------------------------------------------------------------------
+TEST_F(CosmacVipTimingTest, DriverTicksTimersOnMachineCycles)
+{
+    // -- Arrange --
+    MachineDriver driver(mInterpreter);
+
+    // -- Act --
+    const Suspension suspension = driver.Resume(10'000);
+
+    // -- Assert --: the tick lands within the instruction that crosses it
+    EXPECT_EQ(SuspendReason::kTimerTick, suspension.mReason);
+    EXPECT_EQ(3668u, suspension.mCyclesElapsed);
+    EXPECT_GE(mInterpreter.GetClock().GetCycles(), 3668u);
+    EXPECT_LT(mInterpreter.GetClock().GetCycles(), 3668u + 52u);
+}
+
+// A stop cycle inside an instruction stops at the next instruction boundary.
+//--------------------------------------------------------------------------------
+TEST_F(CosmacVipTimingTest, StopsAtFirstBoundaryPastStopCycle)
+{
+    // -- Arrange --
+    StopConditions stopConditions;
+    stopConditions.mStopAtCycle = 75; // Within JP, which runs from 50 to 102
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(1000, stopConditions);
+
+    // -- Assert --
+    EXPECT_EQ(StopReason::kCycleReached, result.mStopReason);
+    EXPECT_EQ(102u, result.mCyclesExecuted);
+    EXPECT_EQ(102u, mInterpreter.GetClock().GetCycles());
+    EXPECT_EQ(PROGRAM_START_ADDRESS, mInterpreter.GetCPU().GetProgramCounter());
+
+    // -- Act --: resuming past the stop cycle runs the full budget
+    const RunResult resumed = mInterpreter.RunCycles(204, stopConditions);
+
+    // -- Assert --
+    EXPECT_EQ(StopReason::kBudgetExhausted, resumed.mStopReason);
+    EXPECT_EQ(306u, mInterpreter.GetClock().GetCycles());
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(CosmacVipTimingTest, InstructionTimingRestoresOneCyclePerInstruction)
+{
+    // -- Act --
+    mInterpreter.SetTimingMode(TimingMode::kInstruction);
+    const RunResult result = mInterpreter.RunCycles(10);
+
+    // -- Assert --
+    EXPECT_EQ(10u, result.mCyclesExecuted);
+    EXPECT_EQ(5, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(10u, mInterpreter.GetClock().GetCycles());
+}
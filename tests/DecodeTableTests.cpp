@@ -0,0 +1,41 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Instruction/DecodeTable.h"
+#include "Interpreter/Instruction/OpcodeTable.h"
+#include "Interpreter/Instruction/OpcodeId.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// Every 16-bit opcode must decode exactly as the reference table scan would.
+//--------------------------------------------------------------------------------
+TEST(DecodeTableTests, MatchesReferenceDecoderForAllOpcodes)
+{
+    for (uint32_t opcode = 0; opcode < DecodeTable::kOpcodeCount; ++opcode)
+    {
+        const uint16_t value = static_cast<uint16_t>(opcode);
+        ASSERT_EQ(OpcodeTable::Match(value), DecodeTable::Lookup(value))
+            << "Decode mismatch for opcode 0x" << std::hex << opcode;
+    }
+}
+
+// CLS and RET must take precedence over the overlapping SYS pattern.
+//--------------------------------------------------------------------------------
+TEST(DecodeTableTests, PrefersClsAndRetOverSys)
+{
+    EXPECT_EQ(OpcodeId::CLS, DecodeTable::Lookup(0x00E0));
+    EXPECT_EQ(OpcodeId::RET, DecodeTable::Lookup(0x00EE));
+    EXPECT_EQ(OpcodeId::SYS_ADDR, DecodeTable::Lookup(0x0123));
+}
+
+// Opcodes outside the instruction set decode to nothing.
+//--------------------------------------------------------------------------------
+TEST(DecodeTableTests, UnknownOpcodesReturnUnassigned)
+{
+    EXPECT_EQ(OpcodeId::UNASSIGNED, DecodeTable::Lookup(0xFFFF));
+    EXPECT_EQ(OpcodeId::UNASSIGNED, DecodeTable::Lookup(0x5001));
+    EXPECT_EQ(OpcodeId::UNASSIGNED, DecodeTable::Lookup(0xE000));
+}
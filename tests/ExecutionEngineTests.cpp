@@ -0,0 +1,319 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Application/RomLoader.h"
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/StopConditions.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <string>
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class ExecutionEngineTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>>
+{
+protected:
+    ExecutionEngineTest()
+        : InterpreterTest(GetParam(), StubRandomProvider(0, 1))
+    { }
+};
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, RunsFullBudget)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // ADD V0, 1
+        0x12, 0x00  // JP 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(100u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_FALSE(result.mShouldHalt);
+    EXPECT_EQ(StopReason::kBudgetExhausted, result.mStopReason);
+    EXPECT_EQ(50, mInterpreter.GetCPU().GetState().mRegisters[0]);
+    EXPECT_EQ(100u, mInterpreter.PeekNextInstruction().mCycleCount);
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, StopsAndHaltsOnDecodeError)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // LD V0, 1
+        0xFF, 0xFF  // Invalid opcode
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(1u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::DecodeError, result.mStatus);
+    EXPECT_TRUE(result.mShouldHalt);
+    EXPECT_EQ(StopReason::kHalted, result.mStopReason);
+    EXPECT_EQ(PROGRAM_START_ADDRESS + INSTRUCTION_SIZE, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, StopsWithoutHaltWhenWaitingOnKey)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // LD V0, 1
+        0xF1, 0x0A  // LD V1, K
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --: the wait counts as a cycle and PC stays on Fx0A
+    EXPECT_EQ(2u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::WaitingOnKeyPress, result.mStatus);
+    EXPECT_FALSE(result.mShouldHalt);
+    EXPECT_EQ(StopReason::kWaitingOnKeyPress, result.mStopReason);
+    EXPECT_EQ(PROGRAM_START_ADDRESS + INSTRUCTION_SIZE, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+// Runs after the wait are blocked until a key is released, and execute nothing.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, BlocksOnKeyWaitUntilKeyReleased)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0xF1, 0x0A, // LD V1, K
+        0x70, 0x01  // ADD V0, 1
+    }));
+    ASSERT_EQ(1u, mInterpreter.RunCycles(100).mCyclesExecuted);
+    Keypad& keypad = mInterpreter.GetBus().mKeypad;
+
+    // -- Act --: a press alone is not a release edge
+    keypad.SetKeyPressed(Key(Key::Key7), true);
+    const RunResult blocked = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_TRUE(mInterpreter.IsWaitingOnKey());
+    EXPECT_EQ(0u, blocked.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::WaitingOnKeyPress, blocked.mStatus);
+    EXPECT_EQ(StopReason::kWaitingOnKeyPress, blocked.mStopReason);
+    EXPECT_EQ(PROGRAM_START_ADDRESS, mInterpreter.GetCPU().GetProgramCounter());
+
+    // -- Act --: the release wakes the wait, which completes with the key
+    keypad.SetKeyPressed(Key(Key::Key7), false);
+    EXPECT_FALSE(mInterpreter.IsWaitingOnKey());
+    const RunResult resumed = mInterpreter.RunCycles(2);
+
+    // -- Assert --
+    EXPECT_EQ(2u, resumed.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::Executed, resumed.mStatus);
+    EXPECT_EQ(Key::Key7, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(1, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
+
+// Timers are driven separately from runs, so they keep ticking while blocked.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, TimersTickWhileBlockedOnKeyWait)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x05, // LD V0, 5
+        0xF0, 0x15, // LD DT, V0
+        0xF1, 0x0A  // LD V1, K
+    }));
+    mInterpreter.RunCycles(100);
+
+    // -- Act --
+    for (int tick = 0; tick < 3; ++tick)
+    {
+        mInterpreter.RunCycles(100);
+        mInterpreter.DecrementTimers();
+    }
+
+    // -- Assert --
+    EXPECT_TRUE(mInterpreter.IsWaitingOnKey());
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mDelayTimer);
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, StopsAfterDisplayChange)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x00, // LD V0, 0
+        0xA0, 0x00, // LD I, 0x000 (font digit 0)
+        0xD0, 0x05, // DRW V0, V0, 5
+        0x70, 0x01, // ADD V0, 1
+        0x12, 0x06  // JP 0x206
+    }));
+
+    StopConditions stopConditions;
+    stopConditions.mStopOnDisplayChange = true;
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100, stopConditions);
+
+    // -- Assert --
+    EXPECT_EQ(3u, result.mCyclesExecuted);
+    EXPECT_EQ(StopReason::kDisplayChanged, result.mStopReason);
+    EXPECT_FALSE(result.mShouldHalt);
+    EXPECT_TRUE(mInterpreter.GetBus().mDisplay.IsPixelSet(0, 0));
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, StopsBeforeBreakpoint)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x12, 0x00  // 0x202: JP 0x200
+    }));
+
+    const uint16_t breakpoints[] = { 0x202 };
+    StopConditions stopConditions;
+    stopConditions.mBreakpoints = breakpoints;
+
+    // -- Act --
+    const RunResult first = mInterpreter.RunCycles(100, stopConditions);
+    const RunResult second = mInterpreter.RunCycles(100, stopConditions);
+
+    // -- Assert --: resuming runs the instruction at the breakpoint
+    EXPECT_EQ(1u, first.mCyclesExecuted);
+    EXPECT_EQ(StopReason::kBreakpoint, first.mStopReason);
+    EXPECT_EQ(2u, second.mCyclesExecuted);
+    EXPECT_EQ(StopReason::kBreakpoint, second.mStopReason);
+    EXPECT_EQ(0x202, mInterpreter.GetCPU().GetProgramCounter());
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
+
+// Straight-line code only checks the end of RAM, but must report it the same way.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, ReportsRunningOffEndOfRam)
+{
+    // -- Arrange --
+    std::vector<uint8_t> rom(RAM_SIZE - PROGRAM_START_ADDRESS, 0x00);
+    rom[0x000] = 0x1F; rom[0x001] = 0xFC; // 0x200: JP 0xFFC
+    rom[0xDFC] = 0x60; rom[0xDFD] = 0x01; // 0xFFC: LD V0, 1
+    rom[0xDFE] = 0x61; rom[0xDFF] = 0x02; // 0xFFE: LD V1, 2
+    ASSERT_TRUE(LoadRom(rom));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(3u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidAddressOutOfBounds, result.mStatus);
+    EXPECT_TRUE(result.mShouldHalt);
+    EXPECT_EQ(RAM_SIZE, mInterpreter.GetCPU().GetProgramCounter());
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mRegisters[1]);
+}
+
+// Control flow always gets the full alignment and bounds validation.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionEngineTest, ReportsInvalidJumpTargets)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x12, 0x05  // 0x202: JP 0x205
+    }));
+
+    // -- Act --
+    const RunResult unaligned = mInterpreter.RunCycles(100);
+    ASSERT_TRUE(LoadRom({
+        0x11, 0xFE  // 0x200: JP 0x1FE
+    }));
+    const RunResult belowProgram = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(2u, unaligned.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidAddressUnaligned, unaligned.mStatus);
+    EXPECT_EQ(1u, belowProgram.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidAddressOutOfBounds, belowProgram.mStatus);
+    EXPECT_EQ(0x1FE, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+//--------------------------------------------------------------------------------
+INSTANTIATE_TEST_SUITE_P(Engines, ExecutionEngineTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
+
+#ifdef ROMS_PATH
+// Every engine must leave the machine in the same state as the switch engine.
+//--------------------------------------------------------------------------------
+TEST(ExecutionEngineEquivalenceTests, BundledRomsMatchSwitchEngine)
+{
+    const RomLoader romLoader(ROMS_PATH);
+    ASSERT_GT(romLoader.RomCount(), 0u);
+
+    const std::vector<ExecutionEngine> engines = { ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure };
+
+    for (const std::string& romName : romLoader.GetRoms())
+    {
+        const std::vector<uint8_t> rom = romLoader.LoadRom(romName);
+
+        for (ExecutionEngine engine : engines)
+        {
+            StubRandomProvider expectedRandom(0, 1);
+            StubRandomProvider actualRandom(0, 1);
+            Interpreter expected(expectedRandom);
+            Interpreter actual(actualRandom);
+            actual.SetExecutionEngine(engine);
+
+            ASSERT_TRUE(expected.LoadRom(rom));
+            ASSERT_TRUE(actual.LoadRom(rom));
+
+            // Run in 60 Hz sized slices with timer ticks in between
+            for (size_t frame = 0; frame < 600; ++frame)
+            {
+                const RunResult expectedResult = expected.RunCycles(9);
+                const RunResult actualResult = actual.RunCycles(9);
+
+                ASSERT_EQ(expectedResult.mCyclesExecuted, actualResult.mCyclesExecuted) << romName;
+                ASSERT_EQ(expectedResult.mStatus, actualResult.mStatus) << romName;
+                ASSERT_EQ(expectedResult.mShouldHalt, actualResult.mShouldHalt) << romName;
+
+                if (expectedResult.mShouldHalt)
+                {
+                    break;
+                }
+
+                expected.DecrementTimers();
+                actual.DecrementTimers();
+            }
+
+            const CPUState& expectedState = expected.GetCPU().GetState();
+            const CPUState& actualState = actual.GetCPU().GetState();
+
+            EXPECT_EQ(expectedState.mRegisters, actualState.mRegisters) << romName;
+            EXPECT_EQ(expectedState.mIndexRegister, actualState.mIndexRegister) << romName;
+            EXPECT_EQ(expectedState.mProgramCounter, actualState.mProgramCounter) << romName;
+            EXPECT_EQ(expectedState.mStackPointer, actualState.mStackPointer) << romName;
+            EXPECT_EQ(expectedState.mStack, actualState.mStack) << romName;
+            EXPECT_EQ(expectedState.mDelayTimer, actualState.mDelayTimer) << romName;
+            EXPECT_EQ(expectedState.mSoundTimer, actualState.mSoundTimer) << romName;
+
+            for (uint32_t y = 0; y < DISPLAY_HEIGHT; ++y)
+            {
+                for (uint32_t x = 0; x < DISPLAY_WIDTH; ++x)
+                {
+                    ASSERT_EQ(expected.GetBus().mDisplay.IsPixelSet(x, y), actual.GetBus().mDisplay.IsPixelSet(x, y))
+                        << romName << " pixel (" << x << ", " << y << ")";
+                }
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,198 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/ExecutionMode.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class ExecutionModeTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>>
+{
+protected:
+    ExecutionModeTest()
+        : InterpreterTest(GetParam())
+    { }
+};
+
+// Seventeen nested calls overflow the sixteen-entry stack.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, CheckedReportsStackOverflow)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kChecked);
+    ASSERT_TRUE(LoadRom({
+        0x22, 0x00 // 0x200: CALL 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(STACK_SIZE, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::StackOverflow, result.mStatus);
+    EXPECT_TRUE(result.mShouldHalt);
+    EXPECT_EQ(PROGRAM_START_ADDRESS, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, CheckedReportsStackUnderflow)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kChecked);
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x00, 0xEE  // 0x202: RET
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(1u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::StackUnderflow, result.mStatus);
+    EXPECT_EQ(0x202, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+// A store that would run past the end of RAM faults before writing anything.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, CheckedReportsOutOfBoundsStore)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kChecked);
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x07, // 0x200: LD V0, 7
+        0xAF, 0xFF, // 0x202: LD I, 0xFFF
+        0xF1, 0x55  // 0x204: LD [I], V1
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(2u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidAddressOutOfBounds, result.mStatus);
+    EXPECT_EQ(0x00, mInterpreter.GetBus().mRAM.Read(0xFFF));
+}
+
+// The same store wraps to the start of RAM when unchecked.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, UncheckedMasksAddresses)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kUnchecked);
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x07, // 0x200: LD V0, 7
+        0x61, 0x09, // 0x202: LD V1, 9
+        0xAF, 0xFF, // 0x204: LD I, 0xFFF
+        0xF1, 0x55  // 0x206: LD [I], V1
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(4);
+
+    // -- Assert --
+    EXPECT_EQ(4u, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_EQ(0x07, mInterpreter.GetBus().mRAM.Read(0xFFF));
+    EXPECT_EQ(0x09, mInterpreter.GetBus().mRAM.Read(0x000));
+}
+
+// Unchecked stack accesses wrap around the stack instead of faulting.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, UncheckedWrapsStackPointer)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x22, 0x00 // 0x200: CALL 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(STACK_SIZE + 1);
+
+    // -- Assert --
+    EXPECT_EQ(ExecutionMode::kUnchecked, mInterpreter.GetExecutionMode());
+    EXPECT_EQ(STACK_SIZE + 1u, result.mCyclesExecuted);
+    EXPECT_EQ(STACK_SIZE + 1, mInterpreter.GetCPU().GetState().mStackPointer);
+}
+
+// Keys and font digits above 0xF fault instead of reading past the keypad or font.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, CheckedReportsKeyAndDigitOutOfRange)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kChecked);
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x10, // 0x200: LD V0, 0x10
+        0xE0, 0x9E  // 0x202: SKP V0
+    }));
+
+    // -- Act --
+    const RunResult keyResult = mInterpreter.RunCycles(100);
+
+    ASSERT_TRUE(LoadRom({
+        0x61, 0x1A, // 0x200: LD V1, 0x1A
+        0xF1, 0x29  // 0x202: LD F, V1
+    }));
+    const RunResult digitResult = mInterpreter.RunCycles(100);
+
+    ASSERT_TRUE(LoadRom({
+        0x62, 0x1A, // 0x200: LD V2, 0x1A
+        0xF2, 0x30  // 0x202: LD HF, V2
+    }, QuirkProfile::kSchip, InstructionSet::kSuperChip));
+    const RunResult bigDigitResult = mInterpreter.RunCycles(100);
+
+    // -- Assert --
+    EXPECT_EQ(1u, keyResult.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidKey, keyResult.mStatus);
+    EXPECT_TRUE(keyResult.mShouldHalt);
+    EXPECT_EQ(1u, digitResult.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidDigit, digitResult.mStatus);
+    EXPECT_EQ(1u, bigDigitResult.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidDigit, bigDigitResult.mStatus);
+    EXPECT_EQ(0x202, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+// Unchecked, the same values use their low nibble.
+//--------------------------------------------------------------------------------
+TEST_P(ExecutionModeTest, UncheckedMasksKeyAndDigit)
+{
+    // -- Arrange --
+    mInterpreter.SetExecutionMode(ExecutionMode::kUnchecked);
+    mInterpreter.GetBus().mKeypad.SetKeyPressed(Key{ Key::KeyA }, true);
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x1A, // 0x200: LD V0, 0x1A
+        0xF0, 0x29, // 0x202: LD F, V0
+        0xE0, 0x9E, // 0x204: SKP V0
+        0x61, 0x01, // 0x206: LD V1, 1
+        0xE0, 0xA1, // 0x208: SKNP V0
+        0x62, 0x01, // 0x20A: LD V2, 1
+        0x12, 0x0C  // 0x20C: JP 0x20C
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(6);
+
+    // -- Assert --
+    const CPUState& state = mInterpreter.GetCPU().GetState();
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_EQ(0xA * 5, state.mIndexRegister);
+    EXPECT_EQ(0, state.mRegisters[1]);
+    EXPECT_EQ(1, state.mRegisters[2]);
+    EXPECT_EQ(0x20C, state.mProgramCounter);
+}
+
+//--------------------------------------------------------------------------------
+INSTANTIATE_TEST_SUITE_P(Engines, ExecutionModeTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
@@ -0,0 +1,151 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+//--------------------------------------------------------------------------------
+class IdleLoopTest : public InterpreterTest<>
+{
+protected:
+    IdleLoopTest()
+    {
+        mInterpreter.SetIdleLoopSkipping(true);
+    }
+};
+
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, SkipsJumpToSelf)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x12, 0x00 // 0x200: JP 0x200
+    }));
+
+    // -- Act --: the first 60 Hz tick falls due at cycle 9
+    const RunResult result = mInterpreter.RunCycles(9);
+
+    // -- Assert --
+    EXPECT_EQ(9u, result.mCyclesExecuted);
+    EXPECT_EQ(StopReason::kBudgetExhausted, result.mStopReason);
+    EXPECT_EQ(7u, mInterpreter.GetIdleCyclesSkipped());
+    EXPECT_EQ(9u, mInterpreter.PeekNextInstruction().mCycleCount);
+    EXPECT_EQ(PROGRAM_START_ADDRESS, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+// A budget spanning a timer tick is only skipped up to the tick; the rest runs.
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, StopsSkippingAtTimerTick)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x12, 0x00 // 0x200: JP 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(1000);
+
+    // -- Assert --
+    EXPECT_EQ(1000u, result.mCyclesExecuted);
+    EXPECT_EQ(7u, mInterpreter.GetIdleCyclesSkipped());
+    EXPECT_EQ(1000u, mInterpreter.PeekNextInstruction().mCycleCount);
+}
+
+// Probing reads ahead without fetching, so only executed instructions are counted.
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, ProbeLeavesCacheCountersAlone)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x12, 0x00 // 0x200: JP 0x200
+    }));
+
+    // -- Act --
+    mInterpreter.RunCycles(9);
+
+    // -- Assert --: only the two instructions the probe executed
+    const InstructionCache& cache = mInterpreter.GetInstructionCache();
+    EXPECT_EQ(2u, cache.GetHitCount() + cache.GetMissCount());
+}
+
+// A delay-timer poll only exits once the timer is decremented between runs.
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, SkipsDelayTimerPollUntilTimerExpires)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x01, // 0x200: LD V0, 1
+        0xF0, 0x15, // 0x202: LD DT, V0
+        0xF1, 0x07, // 0x204: LD V1, DT
+        0x31, 0x00, // 0x206: SE V1, 0
+        0x12, 0x04, // 0x208: JP 0x204
+        0x72, 0x01, // 0x20A: ADD V2, 1
+        0x12, 0x0A  // 0x20C: JP 0x20A
+    }));
+    ASSERT_EQ(2u, mInterpreter.RunCycles(2).mCyclesExecuted);
+
+    // -- Act --: the last partial turn of the loop is still executed
+    const RunResult polling = mInterpreter.RunCycles(7);
+    const uint16_t pollingAddress = mInterpreter.GetCPU().GetProgramCounter();
+    mInterpreter.DecrementTimers();
+    mInterpreter.RunCycles(5);
+
+    // -- Assert --
+    EXPECT_EQ(7u, polling.mCyclesExecuted);
+    EXPECT_EQ(3u, mInterpreter.GetIdleCyclesSkipped());
+    EXPECT_EQ(0x206, pollingAddress);
+    EXPECT_EQ(0x20C, mInterpreter.GetCPU().GetProgramCounter());
+    EXPECT_EQ(1, mInterpreter.GetCPU().GetState().mRegisters[2]);
+}
+
+// Loops that make progress or touch the display must run in full.
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, DoesNotSkipLoopsWithEffects)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x00, 0xE0, // 0x202: CLS
+        0x12, 0x00  // 0x204: JP 0x200
+    }));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(300);
+
+    // -- Assert --
+    EXPECT_EQ(300u, result.mCyclesExecuted);
+    EXPECT_EQ(0u, mInterpreter.GetIdleCyclesSkipped());
+    EXPECT_EQ(100, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
+
+// An effect the loop always skips over does not stop it being idle.
+//--------------------------------------------------------------------------------
+TEST_F(IdleLoopTest, SkipsLoopsWhoseEffectsAreSkippedOver)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x05, // 0x200: LD V0, 5
+        0xF0, 0x15, // 0x202: LD DT, V0
+        0xF1, 0x07, // 0x204: LD V1, DT
+        0x41, 0x00, // 0x206: SNE V1, 0
+        0x00, 0xE0, // 0x208: CLS
+        0x12, 0x04  // 0x20A: JP 0x204
+    }));
+    ASSERT_EQ(2u, mInterpreter.RunCycles(2).mCyclesExecuted);
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(7);
+
+    // -- Assert --
+    EXPECT_EQ(7u, result.mCyclesExecuted);
+    EXPECT_EQ(3u, mInterpreter.GetIdleCyclesSkipped());
+    EXPECT_EQ(0x206, mInterpreter.GetCPU().GetProgramCounter());
+}
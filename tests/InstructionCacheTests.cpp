@@ -0,0 +1,109 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Interpreter/Instruction/InstructionCache.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class InstructionCacheTest : public InterpreterTest<>
+{
+protected:
+    void StepTimes(size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const StepResult result = mInterpreter.Step();
+            ASSERT_FALSE(result.mShouldHalt) << "Unexpected halt at step " << i;
+        }
+    }
+};
+
+//--------------------------------------------------------------------------------
+TEST_F(InstructionCacheTest, RepeatedAddressesHitCache)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x70, 0x01, // ADD V0, 1
+        0x12, 0x00  // JP 0x200
+    };
+    ASSERT_TRUE(LoadRom(rom));
+
+    // -- Act --
+    StepTimes(10);
+
+    // -- Assert --: first pass over each address misses, every later pass hits
+    const InstructionCache& cache = mInterpreter.GetInstructionCache();
+    EXPECT_EQ(2u, cache.GetMissCount());
+    EXPECT_EQ(8u, cache.GetHitCount());
+    EXPECT_EQ(5, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(InstructionCacheTest, RamWriteInvalidatesEntry)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x05, // LD V0, 5
+        0x12, 0x00  // JP 0x200
+    };
+    ASSERT_TRUE(LoadRom(rom));
+    StepTimes(2);
+
+    // -- Act --: patch the low byte of the cached instruction
+    mInterpreter.GetBus().mRAM.Write(PROGRAM_START_ADDRESS + 1, 0x09);
+    StepTimes(1);
+
+    // -- Assert --
+    EXPECT_EQ(0x09, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(InstructionCacheTest, SelfModifyingCodeIsRedecoded)
+{
+    // -- Arrange --: the program overwrites its first instruction with LD V3, 7
+    const std::vector<uint8_t> rom = {
+        0x63, 0x05, // 0x200: LD V3, 5
+        0x60, 0x63, // 0x202: LD V0, 0x63
+        0x61, 0x07, // 0x204: LD V1, 0x07
+        0xA2, 0x00, // 0x206: LD I, 0x200
+        0xF1, 0x55, // 0x208: LD [I], V1
+        0x12, 0x00  // 0x20A: JP 0x200
+    };
+    ASSERT_TRUE(LoadRom(rom));
+
+    // -- Act --
+    StepTimes(6);
+    const uint8_t valueBeforePatch = mInterpreter.GetCPU().GetState().mRegisters[3];
+    StepTimes(1);
+
+    // -- Assert --
+    EXPECT_EQ(5, valueBeforePatch);
+    EXPECT_EQ(7, mInterpreter.GetCPU().GetState().mRegisters[3]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(InstructionCacheTest, LoadRomInvalidatesPreviousProgram)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({ 0x60, 0x01 })); // LD V0, 1
+    StepTimes(1);
+
+    // -- Act --
+    ASSERT_TRUE(LoadRom({ 0x60, 0x02 })); // LD V0, 2
+    StepTimes(1);
+
+    // -- Assert --
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mRegisters[0]);
+}
@@ -0,0 +1,181 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Instruction/DecodeTable.h"
+#include "Interpreter/Instruction/OpcodeTable.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/InstructionSet.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+// Each set's table must decode exactly as the reference scan over its specs.
+//--------------------------------------------------------------------------------
+TEST(InstructionSetTests, DecodeTablesMatchReferenceDecoder)
+{
+    for (InstructionSet instructionSet : { InstructionSet::kChip8, InstructionSet::kSuperChip, InstructionSet::kXoChip })
+    {
+        const DecodeTable::Table& table = DecodeTable::Get(instructionSet);
+        for (uint32_t opcode = 0; opcode < DecodeTable::kOpcodeCount; ++opcode)
+        {
+            const uint16_t value = static_cast<uint16_t>(opcode);
+            ASSERT_EQ(OpcodeTable::Match(value, instructionSet), table[value])
+                << "Decode mismatch for opcode 0x" << std::hex << opcode << " in set " << static_cast<int>(instructionSet);
+        }
+    }
+}
+
+// Extension opcodes only decode from the set that introduces them on.
+//--------------------------------------------------------------------------------
+TEST(InstructionSetTests, ExtensionsOnlyDecodeInTheirSets)
+{
+    const DecodeTable::Table& chip8 = DecodeTable::Get(InstructionSet::kChip8);
+    const DecodeTable::Table& superChip = DecodeTable::Get(InstructionSet::kSuperChip);
+    const DecodeTable::Table& xoChip = DecodeTable::Get(InstructionSet::kXoChip);
+
+    EXPECT_EQ(OpcodeId::SYS_ADDR, chip8[0x00FD]);
+    EXPECT_EQ(OpcodeId::EXIT, superChip[0x00FD]);
+    EXPECT_EQ(OpcodeId::DRW_VX_VY_N, chip8[0xD120]);
+    EXPECT_EQ(OpcodeId::DRW16_VX_VY, superChip[0xD120]);
+
+    EXPECT_EQ(OpcodeId::UNASSIGNED, superChip[0x5012]);
+    EXPECT_EQ(OpcodeId::LD_I_VX_VY, xoChip[0x5012]);
+    EXPECT_EQ(OpcodeId::SYS_ADDR, superChip[0x00D1]);
+    EXPECT_EQ(OpcodeId::SCU_N, xoChip[0x00D1]);
+    EXPECT_EQ(OpcodeId::LD_R_VX, xoChip[0xF375]);
+}
+
+//--------------------------------------------------------------------------------
+class InstructionSetTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>>
+{
+protected:
+    InstructionSetTest()
+        : InterpreterTest(GetParam())
+    { }
+
+    const CPUState& GetState() const { return mInterpreter.GetCPU().GetState(); }
+    bool IsPixelSet(uint32_t x, uint32_t y) const { return mInterpreter.GetBus().mDisplay.IsPixelSet(x, y); }
+};
+
+// 00FD ends the program under SUPER-CHIP; base CHIP-8 reads it as SYS and carries on.
+//--------------------------------------------------------------------------------
+TEST_P(InstructionSetTest, ExitHaltsOnlySuperChipPrograms)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x00, 0xFD, // 0x202: EXIT
+        0x60, 0x02, // 0x204: LD V0, 2
+        0x12, 0x06  // 0x206: JP 0x206
+    };
+
+    // -- Act --
+    ASSERT_TRUE(LoadRom(rom, QuirkProfile::kModern, InstructionSet::kSuperChip));
+    const RunResult exited = mInterpreter.RunCycles(10);
+
+    // -- Assert --
+    EXPECT_TRUE(exited.mShouldHalt);
+    EXPECT_EQ(ExecutionStatus::ProgramExited, exited.mStatus);
+    EXPECT_EQ(1, GetState().mRegisters[0]);
+    EXPECT_EQ(0x202, GetState().mProgramCounter);
+
+    // -- Act --
+    ASSERT_TRUE(LoadRom(rom));
+    const RunResult ran = mInterpreter.RunCycles(10);
+
+    // -- Assert --
+    EXPECT_FALSE(ran.mShouldHalt);
+    EXPECT_EQ(2, GetState().mRegisters[0]);
+    EXPECT_EQ(InstructionSet::kChip8, mInterpreter.GetInstructionSet());
+}
+
+// A 16x16 sprite of the big 8 from Fx30, scrolled right 4 and down 2.
+//--------------------------------------------------------------------------------
+TEST_P(InstructionSetTest, DrawsLargeSpritesAndScrolls)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x08, // 0x200: LD V0, 8
+        0xF0, 0x30, // 0x202: LD HF, V0
+        0x61, 0x00, // 0x204: LD V1, 0
+        0xD1, 0x10, // 0x206: DRW V1, V1, 0 (16x16)
+        0x00, 0xFB, // 0x208: SCR
+        0x00, 0xC2, // 0x20A: SCD 2
+        0x12, 0x0C  // 0x20C: JP 0x20C
+    }, QuirkProfile::kSchip, InstructionSet::kSuperChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(7);
+
+    // -- Assert --: row 0 of the big 8 is 0x3C 0x7E, 16 pixels wide
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_EQ(BIG_CHAR_SET_ADDRESS + 8 * kBigFontSpriteSize, GetState().mIndexRegister);
+    EXPECT_EQ(0, GetState().mRegisters[FLAG_REGISTER_INDEX]);
+
+    EXPECT_FALSE(IsPixelSet(4 + 1, 2));
+    EXPECT_TRUE(IsPixelSet(4 + 2, 2));
+    EXPECT_TRUE(IsPixelSet(4 + 9, 2));
+    EXPECT_FALSE(IsPixelSet(4 + 15, 2));
+    EXPECT_FALSE(IsPixelSet(4 + 2, 1));
+}
+
+// XO-CHIP 5xy2/5xy3 move register ranges in either direction without moving I.
+//--------------------------------------------------------------------------------
+TEST_P(InstructionSetTest, XoChipStoresAndLoadsRegisterRanges)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x61, 0x11, // 0x200: LD V1, 0x11
+        0x62, 0x22, // 0x202: LD V2, 0x22
+        0x63, 0x33, // 0x204: LD V3, 0x33
+        0xA3, 0x00, // 0x206: LD I, 0x300
+        0x53, 0x12, // 0x208: LD [I], V3-V1
+        0x54, 0x63, // 0x20A: LD V4-V6, [I]
+        0xF3, 0x75, // 0x20C: LD R, V3
+        0x12, 0x0E  // 0x20E: JP 0x20E
+    }, QuirkProfile::kModern, InstructionSet::kXoChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(7);
+
+    // -- Assert --
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_EQ(0x300, GetState().mIndexRegister);
+    EXPECT_EQ(0x33, mInterpreter.GetBus().mRAM.Read(0x300));
+    EXPECT_EQ(0x11, mInterpreter.GetBus().mRAM.Read(0x302));
+    EXPECT_EQ(0x33, GetState().mRegisters[4]);
+    EXPECT_EQ(0x11, GetState().mRegisters[6]);
+    EXPECT_EQ(0x22, GetState().mUserFlags[2]);
+}
+
+// The 64x32 CHIP-8 display has no high-res mode to switch to.
+//--------------------------------------------------------------------------------
+TEST_P(InstructionSetTest, HiresIsNotImplementedOnTheChip8Display)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x00, 0xFF, // 0x200: HIGH
+        0x12, 0x02  // 0x202: JP 0x202
+    }, QuirkProfile::kSchip, InstructionSet::kSuperChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(2);
+
+    // -- Assert --
+    EXPECT_TRUE(result.mShouldHalt);
+    EXPECT_EQ(ExecutionStatus::NotImplemented, result.mStatus);
+    EXPECT_EQ(0x200, GetState().mProgramCounter);
+}
+
+INSTANTIATE_TEST_SUITE_P(Engines, InstructionSetTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
@@ -0,0 +1,282 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Interpreter/Jit/JitCompiler.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/QuirkProfile.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// Builds a loop of random register, I, timer, skip, RNG and call opcodes.
+//--------------------------------------------------------------------------------
+std::vector<uint8_t> BuildRandomLoop(std::mt19937& rng)
+{
+    constexpr uint16_t kSubroutineAddress = 0x300;
+    constexpr uint16_t kSubroutineOffset = kSubroutineAddress - PROGRAM_START_ADDRESS;
+
+    std::uniform_int_distribution<int> nibble(0, 15);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> kind(0, 17);
+
+    const uint16_t aluOps[] = { 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0xE };
+
+    std::vector<uint16_t> program;
+    for (int i = 0; i < 40; ++i)
+    {
+        const uint16_t x = static_cast<uint16_t>(nibble(rng) << 8);
+        const uint16_t y = static_cast<uint16_t>(nibble(rng) << 4);
+        const uint16_t kk = static_cast<uint16_t>(byte(rng));
+
+        switch (kind(rng))
+        {
+            case 0: program.push_back(0x6000 | x | kk); break;
+            case 1: program.push_back(0x7000 | x | kk); break;
+            case 2: program.push_back(0x3000 | x | kk); break;
+            case 3: program.push_back(0x4000 | x | kk); break;
+            case 4: program.push_back(0x5000 | x | y); break;
+            case 5: program.push_back(0x9000 | x | y); break;
+            case 6: program.push_back(static_cast<uint16_t>(0xA000 | (0x400 + byte(rng)))); break;
+            case 7: program.push_back(0xF01E | x); break;
+            case 8: program.push_back(0xF007 | x); break;
+            case 9: program.push_back(0xF015 | x); break;
+            case 10: program.push_back(0xF018 | x); break;
+            case 11: program.push_back(0xC000 | x | kk); break;
+            case 12: program.push_back(0x2000 | kSubroutineAddress); break;
+            default: program.push_back(0x8000 | x | y | aluOps[nibble(rng) % 9]); break;
+        }
+    }
+    program.push_back(0x6000); // Keeps a trailing skip off the jump
+    program.push_back(0x1200); // JP 0x200
+
+    std::vector<uint8_t> rom(kSubroutineOffset + 4, 0);
+    for (size_t i = 0; i < program.size(); ++i)
+    {
+        rom[i * 2 + 0] = static_cast<uint8_t>(program[i] >> 8);
+        rom[i * 2 + 1] = static_cast<uint8_t>(program[i] & 0xFF);
+    }
+
+    // Subroutine: ADD VE, 1; RET
+    rom[kSubroutineOffset + 0] = 0x7E;
+    rom[kSubroutineOffset + 1] = 0x01;
+    rom[kSubroutineOffset + 2] = 0x00;
+    rom[kSubroutineOffset + 3] = 0xEE;
+    return rom;
+}
+
+// Compiled blocks must leave the CPU exactly as the switch engine does, under
+// every quirk profile.
+//--------------------------------------------------------------------------------
+TEST(JitCompilerTests, RandomProgramsMatchSwitchEngine)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<size_t> budget(1, 64);
+
+    const QuirkProfile profiles[] = { QuirkProfile::kModern, QuirkProfile::kCosmac, QuirkProfile::kSchip };
+
+    for (int program = 0; program < 60; ++program)
+    {
+        const std::vector<uint8_t> rom = BuildRandomLoop(rng);
+        const QuirkProfile profile = profiles[program % std::size(profiles)];
+
+        StubRandomProvider expectedRandom(37, 37);
+        StubRandomProvider actualRandom(37, 37);
+        Interpreter expected(expectedRandom);
+        Interpreter actual(actualRandom);
+        actual.SetExecutionEngine(ExecutionEngine::kJit);
+
+        ASSERT_TRUE(expected.LoadRom(rom, profile));
+        ASSERT_TRUE(actual.LoadRom(rom, profile));
+
+        for (int slice = 0; slice < 200; ++slice)
+        {
+            const size_t cycles = budget(rng);
+            const RunResult expectedResult = expected.RunCycles(cycles);
+            const RunResult actualResult = actual.RunCycles(cycles);
+
+            ASSERT_EQ(expectedResult.mCyclesExecuted, actualResult.mCyclesExecuted) << "program " << program;
+            ASSERT_EQ(expectedResult.mStatus, actualResult.mStatus) << "program " << program;
+
+            const CPUState& expectedState = expected.GetCPU().GetState();
+            const CPUState& actualState = actual.GetCPU().GetState();
+            ASSERT_EQ(expectedState.mRegisters, actualState.mRegisters) << "program " << program << " slice " << slice;
+            ASSERT_EQ(expectedState.mIndexRegister, actualState.mIndexRegister) << "program " << program;
+            ASSERT_EQ(expectedState.mProgramCounter, actualState.mProgramCounter) << "program " << program;
+            ASSERT_EQ(expectedState.mStackPointer, actualState.mStackPointer) << "program " << program;
+            ASSERT_EQ(expectedState.mDelayTimer, actualState.mDelayTimer) << "program " << program;
+            ASSERT_EQ(expectedState.mSoundTimer, actualState.mSoundTimer) << "program " << program;
+
+            expected.DecrementTimers();
+            actual.DecrementTimers();
+        }
+
+        if (JitCompiler::kIsSupported)
+        {
+            EXPECT_GT(actual.GetJitCompiler().GetCompiledBlockCount(), 0u);
+        }
+    }
+}
+
+// A block touching every register and I holds more values than there are host
+// registers to cache them in, so some are evicted and reloaded mid-block.
+//--------------------------------------------------------------------------------
+TEST(JitCompilerTests, BlocksUsingEveryRegisterMatchSwitchEngine)
+{
+    // -- Arrange --: V(n) += n + 1 for all sixteen, then fold them into V0 and I
+    std::vector<uint8_t> rom;
+    for (uint8_t x = 0; x < REGISTER_COUNT; ++x)
+    {
+        rom.insert(rom.end(), { static_cast<uint8_t>(0x70 | x), static_cast<uint8_t>(x + 1) });
+    }
+    for (uint8_t x = 1; x < REGISTER_COUNT - 1; ++x)
+    {
+        rom.insert(rom.end(), { 0x80, static_cast<uint8_t>((x << 4) | 0x4) }); // ADD V0, Vx
+        rom.insert(rom.end(), { static_cast<uint8_t>(0xF0 | x), 0x1E });       // ADD I, Vx
+    }
+    rom.insert(rom.end(), { 0x12, 0x00 }); // JP 0x200
+
+    StubRandomProvider expectedRandom(37, 37);
+    StubRandomProvider actualRandom(37, 37);
+    Interpreter expected(expectedRandom);
+    Interpreter actual(actualRandom);
+    actual.SetExecutionEngine(ExecutionEngine::kJit);
+    ASSERT_TRUE(expected.LoadRom(rom));
+    ASSERT_TRUE(actual.LoadRom(rom));
+
+    // -- Act --: enough passes for the block to be compiled and run natively
+    const size_t cycles = (rom.size() / INSTRUCTION_SIZE) * (JitCompiler::kHotBlockThreshold + 4);
+    expected.RunCycles(cycles);
+    actual.RunCycles(cycles);
+
+    // -- Assert --
+    EXPECT_EQ(expected.GetCPU().GetState(), actual.GetCPU().GetState());
+    if (JitCompiler::kIsSupported)
+    {
+        EXPECT_GT(actual.GetJitCompiler().GetCompiledBlockCount(), 0u);
+    }
+}
+
+// Fx0A inside a compiled block stops it with PC on the wait and counts the cycle.
+//--------------------------------------------------------------------------------
+TEST(JitCompilerTests, DeferredHandlerStopsCompiledBlock)
+{
+    StubRandomProvider randomProvider(37, 37);
+    Interpreter interpreter(randomProvider);
+    interpreter.SetExecutionEngine(ExecutionEngine::kJit);
+
+    // -- Arrange --
+    ASSERT_TRUE(interpreter.LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x30, 0x20, // 0x202: SE V0, 0x20
+        0x12, 0x00, // 0x204: JP 0x200
+        0x61, 0x07, // 0x206: LD V1, 7
+        0xF2, 0x0A  // 0x208: LD V2, K
+    }));
+
+    // -- Act --
+    const RunResult result = interpreter.RunCycles(1000);
+
+    // -- Assert --: 32 passes of 3 ops, less the JP on the last pass, then LD and the wait
+    EXPECT_EQ(ExecutionStatus::WaitingOnKeyPress, result.mStatus);
+    EXPECT_FALSE(result.mShouldHalt);
+    EXPECT_EQ(32u * 3u - 1u + 2u, result.mCyclesExecuted);
+    EXPECT_EQ(0x208, interpreter.GetCPU().GetProgramCounter());
+    EXPECT_EQ(7, interpreter.GetCPU().GetState().mRegisters[1]);
+
+    // -- Act --: retries are blocked until a key release and run nothing
+    for (uint32_t retry = 0; retry < JitCompiler::kHotBlockThreshold * 2; ++retry)
+    {
+        const RunResult retryResult = interpreter.RunCycles(10);
+
+        // -- Assert --
+        ASSERT_EQ(ExecutionStatus::WaitingOnKeyPress, retryResult.mStatus);
+        ASSERT_EQ(0u, retryResult.mCyclesExecuted);
+        ASSERT_EQ(0x208, interpreter.GetCPU().GetProgramCounter());
+    }
+}
+
+// Two compiled blocks jumping to each other run chained, yet stop exactly where
+// the switch engine does for any budget.
+//--------------------------------------------------------------------------------
+TEST(JitCompilerTests, ChainedBlocksStopWithinTheBudget)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x12, 0x04, // 0x202: JP 0x204
+        0x71, 0x01, // 0x204: ADD V1, 1
+        0x12, 0x00  // 0x206: JP 0x200
+    };
+
+    StubRandomProvider expectedRandom;
+    StubRandomProvider actualRandom;
+    Interpreter expected(expectedRandom);
+    Interpreter actual(actualRandom);
+    actual.SetExecutionEngine(ExecutionEngine::kJit);
+    ASSERT_TRUE(expected.LoadRom(rom));
+    ASSERT_TRUE(actual.LoadRom(rom));
+
+    for (size_t cycles = 1; cycles < 200; cycles += 7)
+    {
+        // -- Act --
+        const RunResult expectedResult = expected.RunCycles(cycles);
+        const RunResult actualResult = actual.RunCycles(cycles);
+
+        // -- Assert --
+        ASSERT_EQ(cycles, actualResult.mCyclesExecuted);
+        ASSERT_EQ(expectedResult.mStatus, actualResult.mStatus);
+        ASSERT_EQ(expected.GetCPU().GetState(), actual.GetCPU().GetState()) << "after " << cycles;
+    }
+
+    if (JitCompiler::kIsSupported)
+    {
+        EXPECT_EQ(2u, actual.GetJitCompiler().GetCompiledBlockCount());
+    }
+}
+
+// A block that rewrites its successor must not chain into the successor's old code.
+//--------------------------------------------------------------------------------
+TEST(JitCompilerTests, RewrittenSuccessorIsNotChained)
+{
+    // -- Arrange --: each pass patches 0x208 to ADD V2, <pass>
+    const std::vector<uint8_t> rom = {
+        0x60, 0x72, // 0x200: LD V0, 0x72
+        0x71, 0x01, // 0x202: ADD V1, 1
+        0xA2, 0x08, // 0x204: LD I, 0x208
+        0xF1, 0x55, // 0x206: LD [I], V0-V1
+        0x72, 0x00, // 0x208: ADD V2, kk (rewritten)
+        0x31, 0x40, // 0x20A: SE V1, 0x40
+        0x12, 0x02, // 0x20C: JP 0x202
+        0x12, 0x0E  // 0x20E: JP 0x20E
+    };
+
+    StubRandomProvider expectedRandom;
+    StubRandomProvider actualRandom;
+    Interpreter expected(expectedRandom);
+    Interpreter actual(actualRandom);
+    actual.SetExecutionEngine(ExecutionEngine::kJit);
+    ASSERT_TRUE(expected.LoadRom(rom));
+    ASSERT_TRUE(actual.LoadRom(rom));
+
+    // -- Act --
+    expected.RunCycles(1000);
+    actual.RunCycles(1000);
+
+    // -- Assert --: V2 = 1 + 2 + ... + 64, modulo 256
+    EXPECT_EQ(expected.GetCPU().GetState(), actual.GetCPU().GetState());
+    EXPECT_EQ(static_cast<uint8_t>(64 * 65 / 2), actual.GetCPU().GetState().mRegisters[2]);
+    EXPECT_EQ(0x20E, actual.GetCPU().GetProgramCounter());
+}
@@ -0,0 +1,109 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interpreter/Hardware/MachineClock.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/StopConditions.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+//--------------------------------------------------------------------------------
+TEST(MachineClockTests, ConvertsBetweenCyclesAndEmulatedTime)
+{
+    const MachineClock clock(500);
+
+    EXPECT_DOUBLE_EQ(2.0, clock.ToSeconds(1000));
+    EXPECT_EQ(2'000'000u, clock.ToMicroseconds(1000));
+    EXPECT_EQ(1000u, clock.FromMicroseconds(2'000'000));
+}
+
+// At 500 Hz, 60 Hz ticks fall due after 8.33 cycles, so on cycles 9, 17 and 25.
+//--------------------------------------------------------------------------------
+TEST(MachineClockTests, PlacesTicksOnTheFirstCycleTheyAreDue)
+{
+    const MachineClock clock(500);
+
+    EXPECT_EQ(0u, clock.CountTicks(8, 60));
+    EXPECT_EQ(1u, clock.CountTicks(9, 60));
+    EXPECT_EQ(2u, clock.CountTicks(17, 60));
+    EXPECT_EQ(9u, clock.GetTickCycle(1, 60));
+    EXPECT_EQ(17u, clock.GetTickCycle(2, 60));
+    EXPECT_EQ(25u, clock.GetTickCycle(3, 60));
+    EXPECT_EQ(60u, clock.CountTicks(clock.GetTickCycle(60, 60), 60));
+}
+
+// Emulated time carries on across a rate change, rounded down to a whole cycle.
+//--------------------------------------------------------------------------------
+TEST(MachineClockTests, ConvertsCyclesWhenFrequencyChanges)
+{
+    MachineClock clock(500);
+    clock.Advance(5);
+
+    clock.SetFrequencyHz(220'080);
+    EXPECT_EQ(2200u, clock.GetCycles());
+
+    clock.SetFrequencyHz(500);
+    EXPECT_EQ(4u, clock.GetCycles());
+}
+
+//--------------------------------------------------------------------------------
+class MachineClockTest : public InterpreterTest<>
+{
+protected:
+    MachineClockTest()
+    {
+        EXPECT_TRUE(LoadRom({
+            0x70, 0x01, // 0x200: ADD V0, 1
+            0x12, 0x00  // 0x202: JP 0x200
+        }));
+    }
+};
+
+// Long runs must not wrap: the clock used to be 16-bit in CPUState.
+//--------------------------------------------------------------------------------
+TEST_F(MachineClockTest, CountsPastSixteenBits)
+{
+    // -- Act --
+    mInterpreter.RunCycles(100'000);
+    mInterpreter.AdvanceClock(5);
+
+    // -- Assert --
+    EXPECT_EQ(100'005u, mInterpreter.GetClock().GetCycles());
+    EXPECT_EQ(100'005u, mInterpreter.PeekNextInstruction().mCycleCount);
+
+    // -- Act --
+    mInterpreter.Reset();
+
+    // -- Assert --
+    EXPECT_EQ(0u, mInterpreter.GetClock().GetCycles());
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(MachineClockTest, StopsAtClockCycle)
+{
+    // -- Arrange --
+    mInterpreter.RunCycles(10);
+    StopConditions stopConditions;
+    stopConditions.mStopAtCycle = 25;
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(100, stopConditions);
+
+    // -- Assert --
+    EXPECT_EQ(StopReason::kCycleReached, result.mStopReason);
+    EXPECT_EQ(15u, result.mCyclesExecuted);
+    EXPECT_EQ(25u, mInterpreter.GetClock().GetCycles());
+
+    // -- Act --: resuming from the stop makes progress
+    const RunResult resumed = mInterpreter.RunCycles(5, stopConditions);
+
+    // -- Assert --
+    EXPECT_EQ(StopReason::kBudgetExhausted, resumed.mStopReason);
+    EXPECT_EQ(30u, mInterpreter.GetClock().GetCycles());
+}
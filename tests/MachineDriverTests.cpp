@@ -0,0 +1,224 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Driver/MachineDriver.h"
+#include "Interpreter/Interpreter.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <array>
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class MachineDriverTest : public InterpreterTest<>
+{
+};
+
+// 500 Hz over 60 Hz ticks every 8.33 cycles: after 9, 17 and 25 cycles.
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, SuspendsOnTimerTicksAtExactCycleBoundaries)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x40, // 0x200: LD V0, 0x40
+        0xF0, 0x15, // 0x202: LD DT, V0
+        0x71, 0x01, // 0x204: ADD V1, 1
+        0x12, 0x04  // 0x206: JP 0x204
+    }));
+    MachineDriver driver(mInterpreter);
+
+    // -- Act --
+    std::vector<size_t> elapsed;
+    size_t cycleBudget = 25;
+    while (cycleBudget > 0)
+    {
+        const Suspension suspension = driver.Resume(cycleBudget);
+        ASSERT_EQ(SuspendReason::kTimerTick, suspension.mReason);
+        elapsed.push_back(suspension.mCyclesElapsed);
+        cycleBudget -= suspension.mCyclesElapsed;
+    }
+
+    // -- Assert --
+    EXPECT_EQ((std::vector<size_t>{ 9, 8, 8 }), elapsed);
+    EXPECT_EQ(0x40 - 3, mInterpreter.GetCPU().GetState().mDelayTimer);
+    EXPECT_EQ(SuspendReason::kBudgetExhausted, driver.Resume(0).mReason);
+}
+
+// A timing mode change while suspended rescales the clock rather than restarting
+// it, so the next tick still falls 1/60 s after the last one.
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, KeepsTickPhaseAcrossTimingModeChanges)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x40, // 0x200: LD V0, 0x40
+        0xF0, 0x15, // 0x202: LD DT, V0
+        0x71, 0x01, // 0x204: ADD V1, 1
+        0x12, 0x04  // 0x206: JP 0x204
+    }));
+    MachineDriver driver(mInterpreter);
+    ASSERT_EQ(SuspendReason::kBudgetExhausted, driver.Resume(5).mReason);
+
+    // -- Act --: 5 of 500 Hz is 2200 of 220,080 Hz, and the tick is due at 3668
+    mInterpreter.SetTimingMode(TimingMode::kCosmacVip);
+    const Suspension vipTick = driver.Resume(10'000);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kTimerTick, vipTick.mReason);
+    EXPECT_EQ(3668u - 2200u, vipTick.mCyclesElapsed);
+    EXPECT_EQ(0x40 - 1, mInterpreter.GetCPU().GetState().mDelayTimer);
+
+    // -- Act --: back at 500 Hz the clock rounds down to cycle 8, just before
+    // the tick already issued; it is not issued again
+    mInterpreter.SetTimingMode(TimingMode::kInstruction);
+    const Suspension tick = driver.Resume(100);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kTimerTick, tick.mReason);
+    EXPECT_EQ(9u, tick.mCyclesElapsed);
+    EXPECT_EQ(17u, mInterpreter.GetClock().GetCycles());
+    EXPECT_EQ(0x40 - 2, mInterpreter.GetCPU().GetState().mDelayTimer);
+}
+
+// The wait is reported once; after that the machine idles and only timers move.
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, IdlesThroughKeyWaitUntilKeyReleased)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x60, 0x40, // 0x200: LD V0, 0x40
+        0xF0, 0x15, // 0x202: LD DT, V0
+        0xF1, 0x0A, // 0x204: LD V1, K
+        0x72, 0x01  // 0x206: ADD V2, 1
+    }));
+    MachineDriver driver(mInterpreter);
+
+    // -- Act --
+    const Suspension wait = driver.Resume(100);
+    const Suspension idle = driver.Resume(100);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kWaitingOnKeyPress, wait.mReason);
+    EXPECT_EQ(3u, wait.mCyclesElapsed);
+    EXPECT_EQ(SuspendReason::kTimerTick, idle.mReason);
+    EXPECT_EQ(6u, idle.mCyclesElapsed);
+    EXPECT_EQ(0x40 - 1, mInterpreter.GetCPU().GetState().mDelayTimer);
+    EXPECT_EQ(0x204, mInterpreter.GetCPU().GetProgramCounter());
+
+    // -- Act --
+    Keypad& keypad = mInterpreter.GetBus().mKeypad;
+    keypad.SetKeyPressed(Key(Key::KeyB), true);
+    keypad.SetKeyPressed(Key(Key::KeyB), false);
+    const Suspension resumed = driver.Resume(2);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kBudgetExhausted, resumed.mReason);
+    EXPECT_EQ(Key::KeyB, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(1, mInterpreter.GetCPU().GetState().mRegisters[2]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, SuspendsOnBreakpointsAndDisplayChanges)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x62, 0x00, // 0x200: LD V2, 0
+        0x60, 0x01, // 0x202: LD V0, 1
+        0xD0, 0x05, // 0x204: DRW V0, V0, 5
+        0x12, 0x06  // 0x206: JP 0x206
+    }));
+    const std::array<uint16_t, 1> breakpoints = { 0x202 };
+    StopConditions stopConditions;
+    stopConditions.mBreakpoints = breakpoints;
+    stopConditions.mStopOnDisplayChange = true;
+    MachineDriver driver(mInterpreter, stopConditions);
+
+    // -- Act --
+    const Suspension breakpoint = driver.Resume(100);
+    const Suspension drawn = driver.Resume(100);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kBreakpoint, breakpoint.mReason);
+    EXPECT_EQ(1u, breakpoint.mCyclesElapsed);
+    EXPECT_EQ(SuspendReason::kDisplayChanged, drawn.mReason);
+    EXPECT_EQ(2u, drawn.mCyclesElapsed);
+    EXPECT_EQ(0x206, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, StaysHaltedUntilRestarted)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0xFF, 0xFF  // 0x202: invalid
+    }));
+    MachineDriver driver(mInterpreter);
+
+    // -- Act --
+    const Suspension halted = driver.Resume(100);
+    const Suspension again = driver.Resume(100);
+
+    // -- Assert --
+    EXPECT_EQ(SuspendReason::kHalted, halted.mReason);
+    EXPECT_EQ(ExecutionStatus::DecodeError, halted.mStatus);
+    EXPECT_EQ(1u, halted.mCyclesElapsed);
+    EXPECT_EQ(SuspendReason::kHalted, again.mReason);
+    EXPECT_EQ(0u, again.mCyclesElapsed);
+    EXPECT_TRUE(driver.IsHalted());
+
+    // -- Act --
+    mInterpreter.Reset();
+    driver.Restart();
+
+    // -- Assert --
+    EXPECT_FALSE(driver.IsHalted());
+    EXPECT_EQ(1u, driver.Resume(100).mCyclesElapsed);
+}
+
+// Machines are independent coroutines, so a scheduler can interleave any number.
+//--------------------------------------------------------------------------------
+TEST_F(MachineDriverTest, InterleavedMachinesMatchRunningEachAlone)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x71, 0x03, // 0x200: ADD V1, 3
+        0x81, 0x14, // 0x202: ADD V1, V1
+        0x12, 0x00  // 0x204: JP 0x200
+    };
+
+    StubRandomProvider otherRandom;
+    Interpreter other(otherRandom);
+    Interpreter alone(otherRandom);
+    ASSERT_TRUE(LoadRom(rom));
+    ASSERT_TRUE(other.LoadRom(rom));
+    ASSERT_TRUE(alone.LoadRom(rom));
+
+    MachineDriver first(mInterpreter);
+    MachineDriver second(other);
+
+    // -- Act --: round robin in slices of 5 cycles, resuming across timer ticks
+    for (int slice = 0; slice < 40; ++slice)
+    {
+        for (MachineDriver* driver : { &first, &second })
+        {
+            for (size_t cycleBudget = 5; cycleBudget > 0; )
+            {
+                cycleBudget -= driver->Resume(cycleBudget).mCyclesElapsed;
+            }
+        }
+    }
+    alone.RunCycles(200);
+
+    // -- Assert --
+    EXPECT_EQ(alone.GetCPU().GetState(), mInterpreter.GetCPU().GetState());
+    EXPECT_EQ(alone.GetCPU().GetState(), other.GetCPU().GetState());
+}
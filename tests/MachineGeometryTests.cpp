@@ -0,0 +1,266 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Bus.h"
+#include "Interpreter/Hardware/CPUState.h"
+#include "Interpreter/Hardware/MachineGeometry.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Each configuration sizes its storage from the geometry alone.
+//--------------------------------------------------------------------------------
+static_assert(RAM::kSize == RAM_SIZE && Display::kWidth == DISPLAY_WIDTH && Display::kHeight == DISPLAY_HEIGHT);
+static_assert(BasicDisplay<SuperChipGeometry>::kWidth == 128 && BasicDisplay<SuperChipGeometry>::kHeight == 64);
+static_assert(BasicRAM<XoChipGeometry>::kSize == 0x10000 && BasicRAM<XoChipGeometry>::kAddressMask == 0xFFFF);
+static_assert(std::tuple_size_v<decltype(CPUState::mStack)> == STACK_SIZE);
+
+// ...and so do the caches of the machine built on it.
+constexpr size_t kXoChipInstructionCount = (XoChipGeometry::kRamSize - PROGRAM_START_ADDRESS) / INSTRUCTION_SIZE;
+static_assert(BasicInstructionCache<XoChipGeometry>::kEntryCount == kXoChipInstructionCount);
+static_assert(BasicBlockCache<XoChipCPU>::kEntryCount == kXoChipInstructionCount);
+static_assert(BasicClosureCache<XoChipCPU>::kEntryCount == kXoChipInstructionCount);
+static_assert(std::is_same_v<XoChipInterpreter::BusType, BasicBus<XoChipGeometry>>);
+
+// A hires display draws up to column 127 and clips at column 128.
+//--------------------------------------------------------------------------------
+TEST(MachineGeometryTests, HiresDisplayDrawsAcrossTheFullWidth)
+{
+    // -- Arrange --
+    const std::unique_ptr<BasicBus<SuperChipGeometry>> bus = std::make_unique<BasicBus<SuperChipGeometry>>();
+    bus->mDisplay.SetRAM(bus->mRAM);
+    bus->mDisplay.SetHires(true);
+    bus->mRAM.Write(0x300, 0xFF);
+
+    // -- Act --
+    const uint8_t collision = bus->mDisplay.DrawSprite(120, 60, 0x300, 1);
+
+    // -- Assert --
+    EXPECT_EQ(0, collision);
+    EXPECT_TRUE(bus->mDisplay.IsPixelSet(120, 60));
+    EXPECT_TRUE(bus->mDisplay.IsPixelSet(127, 60));
+    EXPECT_FALSE(bus->mDisplay.IsPixelSet(0, 60));
+}
+
+// In lores mode the same display draws each pixel as a 2x2 block.
+//--------------------------------------------------------------------------------
+TEST(MachineGeometryTests, LoresDisplayDrawsDoubledPixels)
+{
+    // -- Arrange --
+    const std::unique_ptr<BasicBus<SuperChipGeometry>> bus = std::make_unique<BasicBus<SuperChipGeometry>>();
+    bus->mDisplay.SetRAM(bus->mRAM);
+    bus->mRAM.Write(0x300, 0x80);
+
+    // -- Act --
+    const uint8_t collision = bus->mDisplay.DrawSprite(63, 31, 0x300, 1);
+
+    // -- Assert --
+    EXPECT_EQ(0, collision);
+    EXPECT_FALSE(bus->mDisplay.IsHires());
+    EXPECT_TRUE(bus->mDisplay.IsPixelSet(126, 62));
+    EXPECT_TRUE(bus->mDisplay.IsPixelSet(127, 63));
+    EXPECT_FALSE(bus->mDisplay.IsPixelSet(125, 62));
+}
+
+// XO-CHIP RAM addresses all 64 KB and wraps at 0xFFFF rather than 0xFFF.
+//--------------------------------------------------------------------------------
+TEST(MachineGeometryTests, XoChipRamSpansSixteenBitAddresses)
+{
+    // -- Arrange --
+    const std::unique_ptr<BasicBus<XoChipGeometry>> bus = std::make_unique<BasicBus<XoChipGeometry>>();
+    const std::array<uint8_t, 3> data = { 0x11, 0x22, 0x33 };
+
+    // -- Act --
+    bus->mRAM.Write(0x1000, 0xAA);
+    bus->mRAM.WriteWrapped(0xFFFE, data);
+
+    const std::unique_ptr<std::array<uint8_t, XoChipGeometry::kRamSize>> copy
+        = std::make_unique<std::array<uint8_t, XoChipGeometry::kRamSize>>();
+    bus->mRAM.CopyTo(*copy);
+
+    // -- Assert --
+    EXPECT_EQ(0xAA, bus->mRAM.Read(0x1000));
+    EXPECT_EQ(0x11, bus->mRAM.Read(0xFFFE));
+    EXPECT_EQ(0x22, bus->mRAM.Read(0xFFFF));
+    EXPECT_EQ(0x33, bus->mRAM.Read(0x0000));
+    EXPECT_EQ(0x22, (*copy)[0xFFFF]);
+    EXPECT_EQ(3u, bus->mRAM.View(0x1000, 3).size());
+}
+
+//--------------------------------------------------------------------------------
+class XoChipEngineTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>, XoChipInterpreter>
+{
+protected:
+    XoChipEngineTest()
+        : InterpreterTest(GetParam())
+    { }
+};
+
+// Straight-line code runs on past 4 KB and off the end of 64 KB RAM, where PC
+// wraps to 0 and is reported as out of bounds by every engine.
+//--------------------------------------------------------------------------------
+TEST_P(XoChipEngineTest, RunsToTheEndOfSixtyFourKilobytes)
+{
+    // -- Arrange --
+    std::vector<uint8_t> rom(XoChipGeometry::kRamSize - PROGRAM_START_ADDRESS);
+    for (size_t offset = 0; offset < rom.size(); offset += INSTRUCTION_SIZE)
+    {
+        rom[offset] = 0x60; rom[offset + 1] = 0x01; // LD V0, 1
+    }
+    rom[rom.size() - 2] = 0x61; rom[rom.size() - 1] = 0x02; // 0xFFFE: LD V1, 2
+    ASSERT_TRUE(LoadRom(rom, QuirkProfile::kModern, InstructionSet::kXoChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(kXoChipInstructionCount + 100);
+
+    // -- Assert --
+    EXPECT_EQ(kXoChipInstructionCount, result.mCyclesExecuted);
+    EXPECT_EQ(ExecutionStatus::InvalidAddressOutOfBounds, result.mStatus);
+    EXPECT_TRUE(result.mShouldHalt);
+    EXPECT_EQ(0, mInterpreter.GetCPU().GetProgramCounter());
+    EXPECT_EQ(2, mInterpreter.GetCPU().GetState().mRegisters[1]);
+}
+
+// F000 loads a 16-bit I, and a skip steps over all four of its bytes on every
+// engine, including from blocks hot enough to compile.
+//--------------------------------------------------------------------------------
+TEST_P(XoChipEngineTest, SkipsStepOverLongLoads)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0x70, 0x01,             // 0x200: ADD V0, 1
+        0x40, 0x20,             // 0x202: SNE V0, 0x20
+        0xF0, 0x00, 0xFF, 0xFF, // 0x204: LD I, 0xFFFF (FFFF does not decode)
+        0x71, 0x01,             // 0x208: ADD V1, 1
+        0x31, 0x28,             // 0x20A: SE V1, 0x28
+        0x12, 0x00,             // 0x20C: JP 0x200
+        0x12, 0x0E              // 0x20E: JP 0x20E
+    }, QuirkProfile::kModern, InstructionSet::kXoChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(400);
+
+    // -- Assert --
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_FALSE(result.mShouldHalt);
+    EXPECT_EQ(0xFFFF, mInterpreter.GetCPU().GetState().mIndexRegister);
+    EXPECT_EQ(0x28, mInterpreter.GetCPU().GetState().mRegisters[1]);
+    EXPECT_EQ(0x20E, mInterpreter.GetCPU().GetProgramCounter());
+}
+
+// Fn01 selects the planes Dxyn draws, each reading its own sprite bytes in turn;
+// F002 and Fx3A set the audio pattern and pitch.
+//--------------------------------------------------------------------------------
+TEST_P(XoChipEngineTest, DrawsBitPlanesAndSetsAudio)
+{
+    // -- Arrange --
+    std::vector<uint8_t> rom = {
+        0x00, 0xFF, // 0x200: HIGH
+        0xA2, 0x20, // 0x202: LD I, 0x220
+        0xF2, 0x01, // 0x204: PLANE 2
+        0x60, 0x00, // 0x206: LD V0, 0
+        0xD0, 0x01, // 0x208: DRW V0, V0, 1
+        0xF3, 0x01, // 0x20A: PLANE 3
+        0x61, 0x08, // 0x20C: LD V1, 8
+        0xD1, 0x01, // 0x20E: DRW V1, V0, 1
+        0xF0, 0x02, // 0x210: AUDIO
+        0x62, 0x70, // 0x212: LD V2, 112
+        0xF2, 0x3A, // 0x214: LD PITCH, V2
+        0x12, 0x16  // 0x216: JP 0x216
+    };
+    rom.resize(0x20, 0x00);
+    rom.insert(rom.end(), { 0x80, 0xC0 }); // 0x220: plane 1 row, plane 2 row
+    rom.resize(0x30, 0x00);
+    ASSERT_TRUE(LoadRom(rom, QuirkProfile::kModern, InstructionSet::kXoChip));
+
+    // -- Act --
+    const RunResult result = mInterpreter.RunCycles(11);
+
+    // -- Assert --
+    const BasicDisplay<XoChipGeometry>& display = mInterpreter.GetBus().mDisplay;
+    const SoundTimer& sound = mInterpreter.GetBus().mSoundTimer;
+
+    EXPECT_EQ(ExecutionStatus::Executed, result.mStatus);
+    EXPECT_EQ(2, display.GetPixel(0, 0));
+    EXPECT_EQ(0, display.GetPixel(1, 0));
+    EXPECT_EQ(3, display.GetPixel(8, 0));
+    EXPECT_EQ(2, display.GetPixel(9, 0));
+    EXPECT_EQ(0, mInterpreter.GetCPU().GetState().mRegisters[FLAG_REGISTER_INDEX]);
+    EXPECT_EQ(0x80, sound.GetPattern()[0]);
+    EXPECT_EQ(0xC0, sound.GetPattern()[1]);
+    EXPECT_EQ(112, sound.GetPitch());
+    EXPECT_DOUBLE_EQ(8000.0, sound.GetPlaybackRate());
+}
+
+INSTANTIATE_TEST_SUITE_P(Engines, XoChipEngineTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
+
+//--------------------------------------------------------------------------------
+class SuperChipEngineTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>, SuperChipInterpreter>
+{
+protected:
+    SuperChipEngineTest()
+        : InterpreterTest(GetParam())
+    { }
+
+    bool IsPixelSet(uint32_t x, uint32_t y) const { return mInterpreter.GetBus().mDisplay.IsPixelSet(x, y); }
+};
+
+// 00FF draws to all 128x64 pixels; 00FE returns to 64x32 lores, clearing the screen.
+//--------------------------------------------------------------------------------
+TEST_P(SuperChipEngineTest, SwitchesBetweenHiresAndLores)
+{
+    // -- Arrange --
+    ASSERT_TRUE(LoadRom({
+        0xA2, 0x14, // 0x200: LD I, 0x214
+        0x60, 0x78, // 0x202: LD V0, 120
+        0x61, 0x3C, // 0x204: LD V1, 60
+        0x00, 0xFF, // 0x206: HIGH
+        0xD0, 0x11, // 0x208: DRW V0, V1, 1
+        0x00, 0xFE, // 0x20A: LOW
+        0x60, 0x04, // 0x20C: LD V0, 4
+        0x61, 0x02, // 0x20E: LD V1, 2
+        0xD0, 0x11, // 0x210: DRW V0, V1, 1
+        0x12, 0x12, // 0x212: JP 0x212
+        0xFF        // 0x214: sprite row
+    }, QuirkProfile::kSchip, InstructionSet::kSuperChip));
+
+    // -- Act --
+    const RunResult hires = mInterpreter.RunCycles(5);
+
+    // -- Assert --
+    EXPECT_EQ(ExecutionStatus::Executed, hires.mStatus);
+    EXPECT_TRUE(mInterpreter.GetBus().mDisplay.IsHires());
+    EXPECT_TRUE(IsPixelSet(120, 60));
+    EXPECT_TRUE(IsPixelSet(127, 60));
+    EXPECT_FALSE(IsPixelSet(120, 61));
+
+    // -- Act --
+    const RunResult lores = mInterpreter.RunCycles(4);
+
+    // -- Assert --: lores (4, 2) to (11, 2) covers 8..23 x 4..5
+    EXPECT_EQ(ExecutionStatus::Executed, lores.mStatus);
+    EXPECT_FALSE(mInterpreter.GetBus().mDisplay.IsHires());
+    EXPECT_FALSE(IsPixelSet(120, 60));
+    EXPECT_TRUE(IsPixelSet(8, 4));
+    EXPECT_TRUE(IsPixelSet(23, 5));
+    EXPECT_FALSE(IsPixelSet(24, 4));
+    EXPECT_FALSE(IsPixelSet(7, 4));
+}
+
+INSTANTIATE_TEST_SUITE_P(Engines, SuperChipEngineTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
@@ -14,16 +14,18 @@
 #include <unordered_set>
 
 // Ensure that each opcode pattern in the OpcodeTable is uniquely decodable.
-// Only SYS (0nnn) may overlap with CLS (00E0) and RET (00EE), which are stricter matches.
+// Only SYS (0nnn) may overlap with the stricter 00xx opcodes, and Dxyn with Dxy0.
 //--------------------------------------------------------------------------------
 TEST(OpcodeTableTests, NoUnexpectedDecodeOverlaps)
 {
-    // Known overlaps are intentional: SYS (0nnn) may match CLS (00E0) or RET (00EE)
-    const std::vector<OpcodeId> allowedSYSOverlaps{ OpcodeId::CLS, OpcodeId::RET };
+    // Known overlaps are intentional: the stricter match wins
+    const std::vector<OpcodeId> allowedSYSOverlaps{ OpcodeId::CLS, OpcodeId::RET,
+        OpcodeId::SCD_N, OpcodeId::SCR, OpcodeId::SCL, OpcodeId::EXIT, OpcodeId::LOW, OpcodeId::HIGH, OpcodeId::SCU_N };
 
     auto IsAllowedSYSOverlap = [&](OpcodeId a, OpcodeId b) {
         return (a == OpcodeId::SYS_ADDR &&
-            std::find(allowedSYSOverlaps.begin(), allowedSYSOverlaps.end(), b) != allowedSYSOverlaps.end());
+            std::find(allowedSYSOverlaps.begin(), allowedSYSOverlaps.end(), b) != allowedSYSOverlaps.end())
+            || (a == OpcodeId::DRW_VX_VY_N && b == OpcodeId::DRW16_VX_VY);
     };
 
     auto DecodersMayOverlap = [](const OpcodeSpec& a, const OpcodeSpec& b) {
@@ -41,7 +43,7 @@ TEST(OpcodeTableTests, NoUnexpectedDecodeOverlaps)
         {
             const auto& specB = table[j];
 
-            // Allow SYS to overlap with CLS or RET, but no other overlaps are valid.
+            // Allow the known overlaps, but no others.
             if (IsAllowedSYSOverlap(specA.mOpcodeId, specB.mOpcodeId) ||
                 IsAllowedSYSOverlap(specB.mOpcodeId, specA.mOpcodeId))
             {
@@ -77,4 +79,23 @@ TEST(OpcodeTableTests, PatternWithinMask)
         ASSERT_EQ(spec.mPattern & spec.mMask, spec.mPattern)
             << "Pattern has bits set outside mask: " << spec.mMnemonic;
     }
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------------------------------------
+TEST(OpcodeTableTests, GetReturnsSpecForEveryOpcodeId)
+{
+    for (size_t i = 0; i < OpcodeTable::All().size(); ++i)
+    {
+        const OpcodeId opcodeId = static_cast<OpcodeId>(i);
+        ASSERT_EQ(opcodeId, OpcodeTable::Get(opcodeId).mOpcodeId);
+    }
+}
+
+// The table is usable in constant expressions.
+//--------------------------------------------------------------------------------
+TEST(OpcodeTableTests, UsableAtCompileTime)
+{
+    static_assert(OpcodeTable::Get(OpcodeId::DRW_VX_VY_N).mPattern == 0xD000);
+    static_assert(OpcodeTable::Get(OpcodeId::DRW_VX_VY_N).GetOperands().size() == 3);
+    static_assert(OpcodeTable::Match(0x8123) == OpcodeId::XOR_VX_VY);
+}
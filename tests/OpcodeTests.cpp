@@ -3,7 +3,6 @@
 // Includes
 //--------------------------------------------------------------------------------
 // Interpreter
-#include "Interfaces/IRandomProvider.h"
 #include "Interfaces/IKeyInputProvider.h"
 #include "Constants.h"
 #include "Interpreter/Interpreter.h"
@@ -12,17 +11,13 @@
 #include "Interpreter/Hardware/RAM.h"
 #include "Interpreter/Hardware/CPU.h"
 
+// Test Support
+#include "TestSupport.h"
+
 // Thir Party
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
-//--------------------------------------------------------------------------------
-class MockRandomProvider : public IRandomProvider
-{
-public:
-    MOCK_METHOD(uint8_t, GetRandomByte, (), (override));
-};
-
 //--------------------------------------------------------------------------------
 class DisplayTestAccessor
 {
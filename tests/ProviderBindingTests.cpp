@@ -0,0 +1,115 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interfaces/IKeyInputProvider.h"
+#include "Interfaces/IRandomProvider.h"
+#include "Constants.h"
+#include "Interpreter/Hardware/Keypad.h"
+#include "Interpreter/Hardware/RandomProvider.h"
+#include "Interpreter/Interpreter.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <type_traits>
+
+
+// Returns whatever the test last set.
+//--------------------------------------------------------------------------------
+class FixedRandomProvider final : public IRandomProvider
+{
+public:
+    uint8_t GetRandomByte() override { return mValue; }
+
+    uint8_t mValue = 0;
+};
+
+//--------------------------------------------------------------------------------
+class HeldKeyInputProvider final : public IKeyInputProvider
+{
+public:
+    explicit HeldKeyInputProvider(uint8_t heldKey)
+        : mHeldKey(heldKey)
+    { }
+
+    bool IsKeyPressed(uint8_t physicalKey) const override { return physicalKey == mHeldKey; }
+
+private:
+    uint8_t mHeldKey;
+};
+
+// The interpreter reads the source it was given on every Cxkk.
+//--------------------------------------------------------------------------------
+TEST(ProviderBindingTests, RandomProviderInterfaceDrivesRnd)
+{
+    // -- Arrange --
+    FixedRandomProvider randomSource;
+    Interpreter interpreter(randomSource);
+    ASSERT_TRUE(interpreter.LoadRom({
+        0xC0, 0xFF, // RND V0, 0xFF
+        0xC1, 0x0F  // RND V1, 0x0F
+    }));
+
+    // -- Act --
+    randomSource.mValue = 0x5A;
+    interpreter.RunCycles(2);
+
+    // -- Assert --
+    EXPECT_EQ(0x5A, interpreter.GetCPU().GetState().mRegisters[0]);
+    EXPECT_EQ(0x0A, interpreter.GetCPU().GetState().mRegisters[1]);
+}
+
+// Built for the machine's own provider, the CPU calls it as its concrete type,
+// in every engine.
+//--------------------------------------------------------------------------------
+TEST(ProviderBindingTests, RandomProviderMachineRunsEveryEngine)
+{
+    // -- Arrange --
+    using MachineInterpreter = BasicInterpreter<Chip8Geometry, RandomProvider>;
+    static_assert(std::is_same_v<MachineInterpreter::CPUType::RandomSourceType, RandomProvider>);
+
+    RandomProvider randomProvider;
+    MachineInterpreter interpreter(randomProvider);
+    const ExecutionEngine engines[] = { ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock,
+        ExecutionEngine::kJit, ExecutionEngine::kClosure };
+
+    for (const ExecutionEngine engine : engines)
+    {
+        interpreter.Reset();
+        ASSERT_TRUE(interpreter.LoadRom({
+            0xC0, 0x0F, // RND V0, 0x0F
+            0xC1, 0x00, // RND V1, 0x00
+            0x12, 0x04  // JP 0x204
+        }));
+        interpreter.SetExecutionEngine(engine);
+
+        // -- Act --
+        interpreter.RunCycles(64);
+
+        // -- Assert --
+        EXPECT_LE(interpreter.GetCPU().GetState().mRegisters[0], 0x0F);
+        EXPECT_EQ(0, interpreter.GetCPU().GetState().mRegisters[1]);
+        EXPECT_EQ(0x204, interpreter.GetCPU().GetProgramCounter());
+    }
+}
+
+//--------------------------------------------------------------------------------
+TEST(ProviderBindingTests, KeypadPollsConcreteProvider)
+{
+    // -- Arrange --
+    constexpr uint8_t kPhysicalKey = 42;
+
+    const HeldKeyInputProvider inputProvider(kPhysicalKey);
+    Keypad keypad;
+    keypad.SetKeyBinding(Key{ Key::KeyA }, kPhysicalKey);
+
+    // -- Act --
+    keypad.PollKeypad(inputProvider);
+
+    // -- Assert --
+    EXPECT_TRUE(keypad.IsKeyPressed(Key{ Key::KeyA }));
+    EXPECT_FALSE(keypad.IsKeyPressed(Key{ Key::Key1 }));
+}
@@ -0,0 +1,134 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/QuirkProfile.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+// Every engine must honour the quirk profile selected at ROM load.
+//--------------------------------------------------------------------------------
+class QuirkProfileTest : public InterpreterTest<::testing::TestWithParam<ExecutionEngine>>
+{
+protected:
+    QuirkProfileTest()
+        : InterpreterTest(GetParam())
+    { }
+
+    const CPUState& Run(const std::vector<uint8_t>& rom, QuirkProfile profile, size_t cycles)
+    {
+        EXPECT_TRUE(LoadRom(rom, profile));
+        EXPECT_EQ(cycles, mInterpreter.RunCycles(cycles).mCyclesExecuted);
+        return mInterpreter.GetCPU().GetState();
+    }
+};
+
+//--------------------------------------------------------------------------------
+TEST_P(QuirkProfileTest, CosmacShiftsVyIntoVx)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x40, // LD V0, 0x40
+        0x61, 0x05, // LD V1, 0x05
+        0x62, 0x81, // LD V2, 0x81
+        0x80, 0x16, // SHR V0, V1
+        0x83, 0x2E  // SHL V3, V2
+    };
+
+    // -- Act --
+    const CPUState& state = Run(rom, QuirkProfile::kCosmac, 5);
+
+    // -- Assert --
+    EXPECT_EQ(0x02, state.mRegisters[0]);
+    EXPECT_EQ(0x02, state.mRegisters[3]);
+    EXPECT_EQ(1, state.mRegisters[FLAG_REGISTER_INDEX]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(QuirkProfileTest, CosmacLogicOpsResetFlag)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x6F, 0x07, // LD VF, 7
+        0x60, 0x0C, // LD V0, 0x0C
+        0x61, 0x0A, // LD V1, 0x0A
+        0x80, 0x12  // AND V0, V1
+    };
+
+    // -- Act --
+    const CPUState& state = Run(rom, QuirkProfile::kCosmac, 4);
+
+    // -- Assert --
+    EXPECT_EQ(0x08, state.mRegisters[0]);
+    EXPECT_EQ(0, state.mRegisters[FLAG_REGISTER_INDEX]);
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(QuirkProfileTest, CosmacLoadStoreAdvancesIndex)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0xA3, 0x00, // LD I, 0x300
+        0xF2, 0x55, // LD [I], V2
+        0xF1, 0x65  // LD V1, [I]
+    };
+
+    // -- Act --
+    const CPUState& state = Run(rom, QuirkProfile::kCosmac, 3);
+
+    // -- Assert --: I moves past V0..V2, then past V0..V1
+    EXPECT_EQ(0x305, state.mIndexRegister);
+}
+
+//--------------------------------------------------------------------------------
+TEST_P(QuirkProfileTest, SchipJumpAddsVx)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x10, // LD V0, 0x10
+        0x62, 0x04, // LD V2, 0x04
+        0xB2, 0x00  // JP V2, 0x200
+    };
+
+    // -- Act --
+    const CPUState& state = Run(rom, QuirkProfile::kSchip, 3);
+
+    // -- Assert --
+    EXPECT_EQ(0x204, state.mProgramCounter);
+}
+
+// Reloading with another profile must not reuse blocks bound to the old one.
+//--------------------------------------------------------------------------------
+TEST_P(QuirkProfileTest, ProfileChangeTakesEffectOnReload)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x61, 0x05, // LD V1, 0x05
+        0x80, 0x16, // SHR V0, V1
+        0x12, 0x00  // JP 0x200
+    };
+    const uint8_t modernResult = Run(rom, QuirkProfile::kModern, 300).mRegisters[0];
+
+    // -- Act --
+    const uint8_t cosmacResult = Run(rom, QuirkProfile::kCosmac, 300).mRegisters[0];
+
+    // -- Assert --
+    EXPECT_EQ(0x00, modernResult);
+    EXPECT_EQ(0x02, cosmacResult);
+    EXPECT_EQ(QuirkProfile::kCosmac, mInterpreter.GetQuirkProfile());
+}
+
+//--------------------------------------------------------------------------------
+INSTANTIATE_TEST_SUITE_P(Engines, QuirkProfileTest,
+    ::testing::Values(ExecutionEngine::kSwitch, ExecutionEngine::kThreaded, ExecutionEngine::kBlock, ExecutionEngine::kJit, ExecutionEngine::kClosure));
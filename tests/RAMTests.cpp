@@ -0,0 +1,112 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interfaces/IMemoryWriteListener.h"
+#include "Constants.h"
+#include "Interpreter/Hardware/RAM.h"
+#include "Interpreter/Interpreter.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <array>
+#include <utility>
+#include <vector>
+
+//--------------------------------------------------------------------------------
+class RecordingWriteListener : public IMemoryWriteListener
+{
+public:
+    void OnMemoryWritten(size_t address, size_t length) override { mWrites.emplace_back(address, length); }
+
+    std::vector<std::pair<size_t, size_t>> mWrites;
+};
+
+//--------------------------------------------------------------------------------
+TEST(RAMTests, ViewAndReadRangeRejectBlocksPastTheEnd)
+{
+    // -- Arrange --
+    RAM ram;
+    const std::array<uint8_t, 3> data = { 0x11, 0x22, 0x33 };
+    ASSERT_TRUE(ram.WriteRange(RAM_SIZE - 3, data));
+
+    // -- Act / Assert --
+    const std::span<const uint8_t> view = ram.View(RAM_SIZE - 3, 3);
+    ASSERT_EQ(3u, view.size());
+    EXPECT_EQ(0x22, view[1]);
+    EXPECT_TRUE(ram.View(RAM_SIZE - 2, 3).empty());
+
+    std::array<uint8_t, 3> out{ };
+    EXPECT_TRUE(ram.ReadRange(RAM_SIZE - 3, out));
+    EXPECT_EQ(data, out);
+    EXPECT_FALSE(ram.ReadRange(RAM_SIZE - 2, out));
+}
+
+// A wrapped write lands in two pieces, and listeners hear about each once.
+//--------------------------------------------------------------------------------
+TEST(RAMTests, WrappedBlocksContinueAtAddressZero)
+{
+    // -- Arrange --
+    RAM ram;
+    RecordingWriteListener listener;
+    ram.AddWriteListener(listener);
+    const std::array<uint8_t, 4> data = { 0x01, 0x02, 0x03, 0x04 };
+
+    // -- Act --
+    ram.WriteWrapped(RAM_SIZE - 1, data);
+
+    std::array<uint8_t, 4> out{ };
+    ram.ReadWrapped(RAM_SIZE - 1, out);
+
+    // -- Assert --
+    EXPECT_EQ(0x01, ram.Read(RAM_SIZE - 1));
+    EXPECT_EQ(0x04, ram.Read(0x002));
+    EXPECT_EQ(data, out);
+    EXPECT_EQ((std::vector<std::pair<size_t, size_t>>{ { RAM_SIZE - 1, 1 }, { 0, 3 } }), listener.mWrites);
+}
+
+// Fx55 reports one write for the whole register block.
+//--------------------------------------------------------------------------------
+TEST(RAMTests, RegisterStoreIsOneBlockWrite)
+{
+    // -- Arrange --
+    StubRandomProvider randomProvider;
+    Interpreter interpreter(randomProvider);
+    ASSERT_TRUE(interpreter.LoadRom({
+        0xA3, 0x00, // 0x200: LD I, 0x300
+        0xFF, 0x55  // 0x202: LD [I], VF
+    }));
+
+    RecordingWriteListener listener;
+    interpreter.GetBus().mRAM.AddWriteListener(listener);
+
+    // -- Act --
+    interpreter.RunCycles(2);
+
+    // -- Assert --
+    EXPECT_EQ((std::vector<std::pair<size_t, size_t>>{ { 0x300, REGISTER_COUNT } }), listener.mWrites);
+}
+
+//--------------------------------------------------------------------------------
+TEST(RAMTests, SnapshotCapturesMemory)
+{
+    // -- Arrange --
+    StubRandomProvider randomProvider;
+    Interpreter interpreter(randomProvider);
+    ASSERT_TRUE(interpreter.LoadRom({ 0x60, 0x2A }));
+
+    // -- Act --
+    const Snapshot snapshot = interpreter.PeekNextInstruction();
+    interpreter.GetBus().mRAM.Write(PROGRAM_START_ADDRESS, 0x00);
+
+    // -- Assert --: a copy, unaffected by later writes
+    EXPECT_EQ(0x60, snapshot.mMemory[PROGRAM_START_ADDRESS]);
+    EXPECT_EQ(0x2A, snapshot.mMemory[PROGRAM_START_ADDRESS + 1]);
+    EXPECT_EQ(0xF0, snapshot.mMemory[0]); // Font sprite for 0
+}
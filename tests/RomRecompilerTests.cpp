@@ -0,0 +1,180 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Aot/AotRuntime.h"
+#include "Interpreter/Aot/RomRecompiler.h"
+#include "Interpreter/Interpreter.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <string>
+#include <vector>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+    // The program from InstructionCacheTests that patches its first instruction
+    const std::vector<uint8_t> kSelfModifyingRom = {
+        0x63, 0x05, // 0x200: LD V3, 5
+        0x60, 0x63, // 0x202: LD V0, 0x63
+        0x61, 0x07, // 0x204: LD V1, 0x07
+        0xA2, 0x00, // 0x206: LD I, 0x200
+        0xF1, 0x55, // 0x208: LD [I], V1
+        0x12, 0x00  // 0x20A: JP 0x200
+    };
+
+    // What RomRecompiler::Generate emits for kSelfModifyingRom
+    AotBlockResult Block_200(CPU& cpu)
+    {
+        ExecutionStatus status;
+
+        status = AotRuntime::Execute<ModernQuirks, OpcodeId::LD_VX_KK>(cpu, 0x200, 0x6305);
+        if (status != ExecutionStatus::Executed) { return { status, 0 }; }
+
+        status = AotRuntime::Execute<ModernQuirks, OpcodeId::LD_VX_KK>(cpu, 0x202, 0x6063);
+        if (status != ExecutionStatus::Executed) { return { status, 1 }; }
+
+        status = AotRuntime::Execute<ModernQuirks, OpcodeId::LD_VX_KK>(cpu, 0x204, 0x6107);
+        if (status != ExecutionStatus::Executed) { return { status, 2 }; }
+
+        status = AotRuntime::Execute<ModernQuirks, OpcodeId::LD_I_ADDR>(cpu, 0x206, 0xA200);
+        if (status != ExecutionStatus::Executed) { return { status, 3 }; }
+
+        status = AotRuntime::Execute<ModernQuirks, OpcodeId::LD_I_VX>(cpu, 0x208, 0xF155);
+        if (status != ExecutionStatus::Executed) { return { status, 4 }; }
+
+        return { ExecutionStatus::Executed, 5 };
+    }
+
+    AotBlockResult Block_20A(CPU& cpu)
+    {
+        const ExecutionStatus status = AotRuntime::Execute<ModernQuirks, OpcodeId::JP_ADDR>(cpu, 0x20A, 0x1200);
+        if (status != ExecutionStatus::Executed) { return { status, 0 }; }
+
+        return { ExecutionStatus::Executed, 1 };
+    }
+
+    constexpr AotBlock kBlocks[] = {
+        { 0x200, 5, &Block_200 },
+        { 0x20A, 1, &Block_20A },
+    };
+
+    const AotBlock* FindBlock(uint16_t address)
+    {
+        switch (address)
+        {
+            case 0x200: return &kBlocks[0];
+            case 0x20A: return &kBlocks[1];
+            default: return nullptr;
+        }
+    }
+
+    const AotModule kSelfModifyingModule = {
+        QuirkProfile::kModern,
+        ExecutionMode::kUnchecked,
+        kSelfModifyingRom,
+        &FindBlock,
+    };
+}
+
+//--------------------------------------------------------------------------------
+TEST(RomRecompilerTests, FindsBlocksAlongDirectControlFlow)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x01, // 0x200: LD V0, 1
+        0x22, 0x08, // 0x202: CALL 0x208
+        0x30, 0x01, // 0x204: SE V0, 1
+        0x12, 0x06, // 0x206: JP 0x206
+        0x70, 0x01, // 0x208: ADD V0, 1
+        0x00, 0xEE  // 0x20A: RET
+    };
+
+    // -- Act --
+    const std::vector<RecompiledBlock> blocks = RomRecompiler::FindBlocks(rom);
+
+    // -- Assert --: the return site and both skip outcomes start blocks
+    ASSERT_EQ(4u, blocks.size());
+    EXPECT_EQ(0x200, blocks[0].mAddress);
+    EXPECT_EQ(2u, blocks[0].mInstructions.size());
+    EXPECT_EQ(0x204, blocks[1].mAddress);
+    EXPECT_EQ(1u, blocks[1].mInstructions.size());
+    EXPECT_EQ(0x206, blocks[2].mAddress);
+    EXPECT_EQ(1u, blocks[2].mInstructions.size());
+    EXPECT_EQ(0x208, blocks[3].mAddress);
+    EXPECT_EQ(OpcodeId::RET, blocks[3].mInstructions.back().GetOpcodeId());
+}
+
+// Code only reached through Bnnn is not discovered and is left to the interpreter.
+//--------------------------------------------------------------------------------
+TEST(RomRecompilerTests, StopsAtComputedJump)
+{
+    // -- Arrange --
+    const std::vector<uint8_t> rom = {
+        0x60, 0x00, // 0x200: LD V0, 0
+        0xB2, 0x06, // 0x202: JP V0, 0x206
+        0x70, 0x05, // 0x204: ADD V0, 5
+        0x70, 0x01  // 0x206: ADD V0, 1
+    };
+
+    // -- Act --
+    const std::vector<RecompiledBlock> blocks = RomRecompiler::FindBlocks(rom);
+
+    // -- Assert --
+    ASSERT_EQ(1u, blocks.size());
+    EXPECT_EQ(0x200, blocks[0].mAddress);
+    EXPECT_EQ(OpcodeId::JP_V0_ADDR, blocks[0].mInstructions.back().GetOpcodeId());
+}
+
+//--------------------------------------------------------------------------------
+TEST(RomRecompilerTests, GeneratesModuleForPolicy)
+{
+    // -- Act --
+    const std::string source = RomRecompiler::Generate(kSelfModifyingRom, "Rom_test", "test.ch8",
+        QuirkProfile::kCosmac, ExecutionMode::kChecked);
+
+    // -- Assert --
+    EXPECT_NE(std::string::npos, source.find("using Quirks = CheckedCosmacQuirks;"));
+    EXPECT_NE(std::string::npos, source.find("AotRuntime::Execute<Quirks, OpcodeId::LD_I_VX>(cpu, 0x208, 0xF155)"));
+    EXPECT_NE(std::string::npos, source.find("case 0x20A: return &kBlocks[1];"));
+    EXPECT_NE(std::string::npos, source.find("const AotModule& Rom_test()"));
+    EXPECT_EQ("Rom_3_corax_", RomRecompiler::MakeFunctionName("3-corax+.ch8"));
+}
+
+// Patched blocks and budgets ending mid-block fall back to the interpreter.
+//--------------------------------------------------------------------------------
+TEST(RomRecompilerTests, RuntimeMatchesInterpreterOnSelfModifyingCode)
+{
+    // -- Arrange --
+    StubRandomProvider expectedRandom;
+    StubRandomProvider actualRandom;
+    Interpreter expected(expectedRandom);
+    Interpreter actual(actualRandom);
+    ASSERT_TRUE(expected.LoadRom(kSelfModifyingRom));
+    ASSERT_TRUE(actual.LoadRom(kSelfModifyingRom));
+
+    // -- Act --
+    for (size_t budget : { 3u, 4u, 5u, 7u, 11u })
+    {
+        const RunResult expectedResult = expected.RunCycles(budget);
+        const RunResult actualResult = AotRuntime::Run(actual, kSelfModifyingModule, budget);
+
+        // -- Assert --
+        ASSERT_EQ(expectedResult.mCyclesExecuted, actualResult.mCyclesExecuted);
+        ASSERT_EQ(expectedResult.mStatus, actualResult.mStatus);
+        ASSERT_EQ(expectedResult.mStopReason, actualResult.mStopReason);
+        ASSERT_EQ(expected.GetCPU().GetState(), actual.GetCPU().GetState());
+    }
+
+    EXPECT_EQ(7, actual.GetCPU().GetState().mRegisters[3]);
+    EXPECT_EQ(30u, actual.PeekNextInstruction().mCycleCount);
+}
@@ -0,0 +1,131 @@
+#define UNIT_TESTING
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Engine/BlockCache.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+
+// Test Support
+#include "TestSupport.h"
+
+// Third Party
+#include <gtest/gtest.h>
+
+// System
+#include <vector>
+
+// Runs the ROM on the switch and block engines in uneven slices, so budgets also
+// end inside fused sequences, and checks both stay in lockstep.
+//--------------------------------------------------------------------------------
+void ExpectMatchesSwitchEngine(const std::vector<uint8_t>& rom, size_t totalCycles)
+{
+    StubRandomProvider expectedRandom(0x5A);
+    StubRandomProvider actualRandom(0x5A);
+    Interpreter expected(expectedRandom);
+    Interpreter actual(actualRandom);
+    actual.SetExecutionEngine(ExecutionEngine::kBlock);
+
+    ASSERT_TRUE(expected.LoadRom(rom));
+    ASSERT_TRUE(actual.LoadRom(rom));
+
+    size_t executed = 0;
+    for (size_t slice = 1; executed < totalCycles; slice = slice % 7 + 1)
+    {
+        const RunResult expectedResult = expected.RunCycles(slice);
+        const RunResult actualResult = actual.RunCycles(slice);
+        ASSERT_EQ(expectedResult.mCyclesExecuted, actualResult.mCyclesExecuted);
+        ASSERT_EQ(expectedResult.mStatus, actualResult.mStatus);
+
+        const CPUState& expectedState = expected.GetCPU().GetState();
+        const CPUState& actualState = actual.GetCPU().GetState();
+        ASSERT_EQ(expectedState.mRegisters, actualState.mRegisters) << "after " << executed << " cycles";
+        ASSERT_EQ(expectedState.mIndexRegister, actualState.mIndexRegister);
+        ASSERT_EQ(expectedState.mProgramCounter, actualState.mProgramCounter) << "after " << executed << " cycles";
+
+        if (expectedResult.mShouldHalt)
+        {
+            break;
+        }
+        executed += expectedResult.mCyclesExecuted;
+    }
+
+    for (uint32_t y = 0; y < DISPLAY_HEIGHT; ++y)
+    {
+        for (uint32_t x = 0; x < DISPLAY_WIDTH; ++x)
+        {
+            ASSERT_EQ(expected.GetBus().mDisplay.IsPixelSet(x, y), actual.GetBus().mDisplay.IsPixelSet(x, y));
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------
+TEST(SuperinstructionsTests, LoadPairMatchesSwitchEngine)
+{
+    ExpectMatchesSwitchEngine({
+        0x60, 0x11, // 0x200: LD V0, 0x11
+        0x61, 0x22, // 0x202: LD V1, 0x22
+        0x62, 0x33, // 0x204: LD V2, 0x33
+        0x80, 0x14, // 0x206: ADD V0, V1
+        0x12, 0x00  // 0x208: JP 0x200
+    }, 200);
+}
+
+//--------------------------------------------------------------------------------
+TEST(SuperinstructionsTests, LoadIndexAndDrawMatchesSwitchEngine)
+{
+    ExpectMatchesSwitchEngine({
+        0x70, 0x03, // 0x200: ADD V0, 3
+        0xA0, 0x0A, // 0x202: LD I, 0x00A (font digit 2)
+        0xD0, 0x15, // 0x204: DRW V0, V1, 5
+        0x71, 0x01, // 0x206: ADD V1, 1
+        0x12, 0x00  // 0x208: JP 0x200
+    }, 300);
+}
+
+//--------------------------------------------------------------------------------
+TEST(SuperinstructionsTests, LoopCounterMatchesSwitchEngine)
+{
+    ExpectMatchesSwitchEngine({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x30, 0x40, // 0x202: SE V0, 0x40
+        0x12, 0x00, // 0x204: JP 0x200
+        0x60, 0x00, // 0x206: LD V0, 0
+        0x71, 0x01, // 0x208: ADD V1, 1
+        0x41, 0x03, // 0x20A: SNE V1, 3
+        0x12, 0x10, // 0x20C: JP 0x210
+        0x12, 0x00, // 0x20E: JP 0x200
+        0x61, 0x00, // 0x210: LD V1, 0
+        0x72, 0x02, // 0x212: ADD V2, 2
+        0x32, 0x10, // 0x214: SE V2, 0x10
+        0x63, 0x01, // 0x216: LD V3, 1
+        0x12, 0x00  // 0x218: JP 0x200
+    }, 2000);
+}
+
+//--------------------------------------------------------------------------------
+TEST(SuperinstructionsTests, SkipKeepsGuardedJumpInBlock)
+{
+    // -- Arrange --
+    StubRandomProvider randomProvider(0x5A);
+    Interpreter interpreter(randomProvider);
+    interpreter.SetExecutionEngine(ExecutionEngine::kBlock);
+    ASSERT_TRUE(interpreter.LoadRom({
+        0x70, 0x01, // 0x200: ADD V0, 1
+        0x30, 0x04, // 0x202: SE V0, 4
+        0x12, 0x00, // 0x204: JP 0x200
+        0x61, 0x07  // 0x206: LD V1, 7
+    }));
+
+    // -- Act --: three passes of 3 instructions, then ADD, the taken skip and LD
+    const RunResult result = interpreter.RunCycles(12);
+
+    // -- Assert --
+    const TranslatedBlock* block = interpreter.GetBlockCache().Find(PROGRAM_START_ADDRESS);
+    ASSERT_NE(nullptr, block);
+    EXPECT_EQ(3u, block->mOps.size());
+    EXPECT_EQ(12u, result.mCyclesExecuted);
+    EXPECT_EQ(7, interpreter.GetCPU().GetState().mRegisters[1]);
+}
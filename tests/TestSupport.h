@@ -0,0 +1,76 @@
+#pragma once
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Interfaces/IRandomProvider.h"
+#include "Interpreter/Interpreter.h"
+#include "Types/ExecutionEngine.h"
+#include "Types/InstructionSet.h"
+#include "Types/QuirkProfile.h"
+
+// Third Party
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// System
+#include <cstdint>
+#include <vector>
+
+// Returns first, then steps by a fixed amount on each call (a step of zero
+// repeats first). Deterministic, so independent interpreters see identical bytes.
+//--------------------------------------------------------------------------------
+class StubRandomProvider : public IRandomProvider
+{
+public:
+    explicit StubRandomProvider(uint8_t first = 0, uint8_t step = 0)
+        : mNext(first)
+        , mStep(step)
+    { }
+
+    uint8_t GetRandomByte() override
+    {
+        const uint8_t value = mNext;
+        mNext = static_cast<uint8_t>(mNext + mStep);
+        return value;
+    }
+
+private:
+    uint8_t mNext;
+    uint8_t mStep;
+};
+
+//--------------------------------------------------------------------------------
+class MockRandomProvider : public IRandomProvider
+{
+public:
+    MOCK_METHOD(uint8_t, GetRandomByte, (), (override));
+};
+
+// Base for fixtures that run one interpreter on one engine. TBase is the gtest
+// fixture, e.g. ::testing::TestWithParam<ExecutionEngine> for engine sweeps, and
+// TInterpreter the machine configuration.
+//--------------------------------------------------------------------------------
+template <typename TBase = ::testing::Test, typename TInterpreter = Interpreter>
+class InterpreterTest : public TBase
+{
+protected:
+    explicit InterpreterTest(ExecutionEngine engine = ExecutionEngine::kSwitch, StubRandomProvider randomProvider = StubRandomProvider())
+        : mRandomProvider(randomProvider)
+        , mInterpreter(mRandomProvider)
+    {
+        mInterpreter.SetExecutionEngine(engine);
+    }
+
+    // Resets the machine first (LoadRom alone keeps PC and registers), so a test
+    // can load several ROMs in turn.
+    [[nodiscard]] bool LoadRom(const std::vector<uint8_t>& rom, QuirkProfile profile = QuirkProfile::kModern,
+        InstructionSet instructionSet = InstructionSet::kChip8)
+    {
+        mInterpreter.Reset();
+        return mInterpreter.LoadRom(rom, profile, instructionSet);
+    }
+
+    StubRandomProvider mRandomProvider;
+    TInterpreter mInterpreter;
+};
@@ -0,0 +1,103 @@
+/*
+	Ahead-of-time recompiler.
+
+	Translates a .ch8 ROM into a C++ translation unit that runs its reachable
+	basic blocks natively through AotRuntime (see RomRecompiler).
+
+	Usage: Chip8_recompiler <rom.ch8> <output.cpp> [--profile modern|cosmac|schip] [--checked] [--name functionName]
+*/
+
+// Includes
+//--------------------------------------------------------------------------------
+// Interpreter
+#include "Constants.h"
+#include "Interpreter/Aot/RomRecompiler.h"
+#include "Types/ExecutionMode.h"
+#include "Types/QuirkProfile.h"
+
+// System
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Anonymous namespace - limits linkage to this translation unit
+//--------------------------------------------------------------------------------
+namespace
+{
+	//--------------------------------------------------------------------------------
+	bool ParseProfile(std::string_view name, QuirkProfile& profile)
+	{
+		if (name == "modern") { profile = QuirkProfile::kModern; return true; }
+		if (name == "cosmac") { profile = QuirkProfile::kCosmac; return true; }
+		if (name == "schip")  { profile = QuirkProfile::kSchip;  return true; }
+		return false;
+	}
+
+	//--------------------------------------------------------------------------------
+	int PrintUsage()
+	{
+		std::fprintf(stderr, "Usage: Chip8_recompiler <rom.ch8> <output.cpp> [--profile modern|cosmac|schip] [--checked] [--name functionName]\n");
+		return 1;
+	}
+}
+
+//--------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		return PrintUsage();
+	}
+
+	const std::filesystem::path romPath = argv[1];
+	const std::filesystem::path outputPath = argv[2];
+
+	QuirkProfile profile = QuirkProfile::kModern;
+	ExecutionMode mode = ExecutionMode::kUnchecked;
+	std::string functionName = RomRecompiler::MakeFunctionName(romPath.filename().string());
+
+	for (int i = 3; i < argc; ++i)
+	{
+		const std::string_view option = argv[i];
+		if (option == "--checked")
+		{
+			mode = ExecutionMode::kChecked;
+		}
+		else if (option == "--profile" && i + 1 < argc && ParseProfile(argv[i + 1], profile))
+		{
+			++i;
+		}
+		else if (option == "--name" && i + 1 < argc)
+		{
+			functionName = argv[++i];
+		}
+		else
+		{
+			return PrintUsage();
+		}
+	}
+
+	std::ifstream romFile(romPath, std::ios::binary);
+	const std::vector<uint8_t> rom((std::istreambuf_iterator<char>(romFile)), std::istreambuf_iterator<char>());
+	if (!romFile || rom.empty() || rom.size() > RAM_SIZE - PROGRAM_START_ADDRESS)
+	{
+		std::fprintf(stderr, "Cannot recompile %s: missing, empty or too large.\n", romPath.string().c_str());
+		return 1;
+	}
+
+	const std::string source = RomRecompiler::Generate(rom, functionName, romPath.filename().string(), profile, mode);
+
+	std::ofstream outputFile(outputPath, std::ios::binary);
+	outputFile << source;
+	if (!outputFile)
+	{
+		std::fprintf(stderr, "Cannot write %s.\n", outputPath.string().c_str());
+		return 1;
+	}
+
+	return 0;
+}